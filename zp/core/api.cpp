@@ -96,7 +96,7 @@ enum struct ForwardData
         this.OnClientSkillUsed       = CreateGlobalForward("ZP_OnClientSkillUsed", ET_Hook, Param_Cell);
         this.OnClientSkillOver       = CreateGlobalForward("ZP_OnClientSkillOver", ET_Ignore, Param_Cell);
         this.OnClientMoney           = CreateGlobalForward("ZP_OnClientMoney", ET_Ignore, Param_Cell, Param_CellByRef);
-        this.OnClientLevel           = CreateGlobalForward("ZP_OnClientLevel", ET_Ignore, Param_Cell, Param_CellByRef);
+        this.OnClientLevel           = CreateGlobalForward("ZP_OnClientLevel", ET_Ignore, Param_Cell, Param_CellByRef, Param_Cell);
         this.OnClientExp             = CreateGlobalForward("ZP_OnClientExp", ET_Ignore, Param_Cell, Param_CellByRef);
         this.OnGrenadeCreated        = CreateGlobalForward("ZP_OnGrenadeCreated", ET_Ignore, Param_Cell, Param_Cell, Param_Cell);
         this.OnGrenadeSound          = CreateGlobalForward("ZP_OnGrenadeSound", ET_Hook, Param_Cell, Param_Cell);
@@ -386,12 +386,14 @@ enum struct ForwardData
      * 
      * @param client            The client index.
      * @param iLevel            The level amount.
+     * @param iLast             The previous level amount.
      **/
-    void _OnClientLevel(int client, int &iLevel)
+    void _OnClientLevel(int client, int &iLevel, int iLast)
     {
         Call_StartForward(this.OnClientLevel);
         Call_PushCell(client);
         Call_PushCellRef(iLevel);
+        Call_PushCell(iLast);
         Call_Finish();
     }
     
@@ -652,6 +654,7 @@ APLRes APIOnInit(/*void*/)
     MenusOnNativeInit();
     GameModesOnNativeInit();
     CostumesOnNativeInit();
+    SchedulerOnNativeInit();
     
     // Register natives
     APIOnNativeInit();
@@ -33,7 +33,9 @@ void CommandsOnInit(/*void*/)
     // Forward event to modules
     DebugOnCommandInit();
     ConfigOnCommandInit();
+    CvarsOnCommandInit();
     LogOnCommandInit();
+    SchedulerOnCommandInit();
     DeathOnCommandInit();
     SpawnOnCommandInit();
     MenusOnCommandInit();
@@ -43,5 +45,6 @@ void CommandsOnInit(/*void*/)
     GameModesOnCommandInit();
     ExtraItemsOnCommandInit();
     CostumesOnCommandInit();
+    SoundsOnCommandInit();
     VersionOnCommandInit();
 }
\ No newline at end of file
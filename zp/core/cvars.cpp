@@ -97,6 +97,10 @@ enum struct CvarsList
     ConVar LOG_IGNORE_CONSOLE;
     ConVar LOG_ERROR_OVERRIDE;
     ConVar LOG_PRINT_CHAT;
+    ConVar LOG_BUFFER;
+    ConVar LOG_BUFFER_SIZE;
+    ConVar LOG_BUFFER_FLUSH;
+    ConVar LOG_BUFFER_LIMIT;
            
     ConVar JUMPBOOST;
     ConVar JUMPBOOST_MULTIPLIER;
@@ -241,6 +245,7 @@ enum struct CvarsList
     ConVar MESSAGES_COUNTER;
     ConVar MESSAGES_BLAST;
     ConVar MESSAGES_DAMAGE;
+    ConVar MESSAGES_DAMAGE_INTERVAL;
     ConVar MESSAGES_DONATE;
     ConVar MESSAGES_CLASS_INFO;
     ConVar MESSAGES_CLASS_CHOOSE;
@@ -263,6 +268,85 @@ enum struct CvarsList
  **/
 CvarsList gCvarList;
 
+/**
+ * @section Struct of cvar values which are read in the hot paths.
+ **/
+enum struct CvarsSnapshot
+{
+    /* State */
+    bool Loaded;
+
+    /* Logs */
+    bool Log;
+    bool LogModuleFilter;
+    bool LogIgnoreConsole;
+    bool LogErrorOverride;
+    bool LogPrintChat;
+    bool LogBuffer;
+    int LogBufferSize;
+    float LogBufferLimit;
+
+    /* Hitgroups */
+    bool HitGroup;
+    bool Knockback;
+    float KnockbackAir;
+
+    /* Levels */
+    bool LevelSystem;
+    float LevelHealthRatio;
+    float LevelSpeedRatio;
+    float LevelGravityRatio;
+    float LevelDamageRatio;
+
+    /* Messages */
+    bool MessagesDamage;
+    float MessagesDamageInterval;
+
+    /* Sounds */
+    int SoundLevel;
+    bool SoundFootsteps;
+    bool SoundClaws;
+    bool SoundBurn;
+
+    /**
+     * @brief Reads all values from the cvars.
+     **/
+    void Update(/*void*/)
+    {
+        this.Loaded                 = true;
+        this.Log                    = gCvarList.LOG.BoolValue;
+        this.LogModuleFilter        = gCvarList.LOG_MODULE_FILTER.BoolValue;
+        this.LogIgnoreConsole       = gCvarList.LOG_IGNORE_CONSOLE.BoolValue;
+        this.LogErrorOverride       = gCvarList.LOG_ERROR_OVERRIDE.BoolValue;
+        this.LogPrintChat           = gCvarList.LOG_PRINT_CHAT.BoolValue;
+        this.LogBuffer              = gCvarList.LOG_BUFFER.BoolValue;
+        this.LogBufferSize          = gCvarList.LOG_BUFFER_SIZE.IntValue;
+        this.LogBufferLimit         = gCvarList.LOG_BUFFER_LIMIT.FloatValue;
+        this.HitGroup               = gCvarList.HITGROUP.BoolValue;
+        this.Knockback              = gCvarList.HITGROUP_KNOCKBACK.BoolValue;
+        this.KnockbackAir           = gCvarList.HITGROUP_KNOCKBACK_AIR.FloatValue;
+        this.LevelSystem            = gCvarList.LEVEL_SYSTEM.BoolValue;
+        this.LevelHealthRatio       = gCvarList.LEVEL_HEALTH_RATIO.FloatValue;
+        this.LevelSpeedRatio        = gCvarList.LEVEL_SPEED_RATIO.FloatValue;
+        this.LevelGravityRatio      = gCvarList.LEVEL_GRAVITY_RATIO.FloatValue;
+        this.LevelDamageRatio       = gCvarList.LEVEL_DAMAGE_RATIO.FloatValue;
+        this.MessagesDamage         = gCvarList.MESSAGES_DAMAGE.BoolValue;
+        this.MessagesDamageInterval = gCvarList.MESSAGES_DAMAGE_INTERVAL.FloatValue;
+        this.SoundLevel             = gCvarList.SEFFECTS_LEVEL.IntValue;
+        this.SoundFootsteps         = gCvarList.SEFFECTS_FOOTSTEPS.BoolValue;
+        this.SoundClaws             = gCvarList.SEFFECTS_CLAWS.BoolValue;
+        this.SoundBurn              = gCvarList.SEFFECTS_BURN.BoolValue;
+    }
+}
+/**
+ * @endsection
+ **/
+
+/**
+ * Array to store the snapshot of cvar values.
+ **/
+CvarsSnapshot gCvarSnapshot;
+
 /**
  * @brief Cvars module init function.
  **/
@@ -282,6 +366,9 @@ void CvarsOnInit(/*void*/)
     HitGroupsOnCvarInit();
     CostumesOnCvarInit();
     MenusOnCvarInit();
+    
+    // Prepare the snapshot
+    CvarsOnSnapshotInit();
 
     // Creates revision cvar
     CreateConVar("zombieplague_revision", PLUGIN_VERSION, "Revision number for this plugin in source code repository.", FCVAR_SPONLY|FCVAR_UNLOGGED|FCVAR_DONTRECORD|FCVAR_REPLICATED|FCVAR_NOTIFY);
@@ -290,6 +377,135 @@ void CvarsOnInit(/*void*/)
     FindConVar("sv_tags").SetString(PLUGIN_TAG, true);
 }
 
+/**
+ * @brief Creates commands for cvars module.
+ **/
+void CvarsOnCommandInit(/*void*/)
+{
+    // Hook commands
+    RegAdminCmd("zp_cvars_reload", CvarsReloadOnCommandCatched, ADMFLAG_CONFIG, "Reloads and prints the snapshot of the hot path cvars. Usage: zp_cvars_reload");
+}
+
+/**
+ * @brief Hook snapshot cvar changes and load the values.
+ **/
+void CvarsOnSnapshotInit(/*void*/)
+{
+    // Hook cvars
+    HookConVarChange(gCvarList.LOG,                      CvarsSnapshotOnCvarHook);
+    HookConVarChange(gCvarList.LOG_MODULE_FILTER,        CvarsSnapshotOnCvarHook);
+    HookConVarChange(gCvarList.LOG_IGNORE_CONSOLE,       CvarsSnapshotOnCvarHook);
+    HookConVarChange(gCvarList.LOG_ERROR_OVERRIDE,       CvarsSnapshotOnCvarHook);
+    HookConVarChange(gCvarList.LOG_PRINT_CHAT,           CvarsSnapshotOnCvarHook);
+    HookConVarChange(gCvarList.LOG_BUFFER,               CvarsSnapshotOnCvarHook);
+    HookConVarChange(gCvarList.LOG_BUFFER_SIZE,          CvarsSnapshotOnCvarHook);
+    HookConVarChange(gCvarList.LOG_BUFFER_LIMIT,         CvarsSnapshotOnCvarHook);
+    HookConVarChange(gCvarList.HITGROUP,                 CvarsSnapshotOnCvarHook);
+    HookConVarChange(gCvarList.HITGROUP_KNOCKBACK,       CvarsSnapshotOnCvarHook);
+    HookConVarChange(gCvarList.HITGROUP_KNOCKBACK_AIR,   CvarsSnapshotOnCvarHook);
+    HookConVarChange(gCvarList.LEVEL_SYSTEM,             CvarsSnapshotOnCvarHook);
+    HookConVarChange(gCvarList.LEVEL_HEALTH_RATIO,       CvarsSnapshotOnCvarHook);
+    HookConVarChange(gCvarList.LEVEL_SPEED_RATIO,        CvarsSnapshotOnCvarHook);
+    HookConVarChange(gCvarList.LEVEL_GRAVITY_RATIO,      CvarsSnapshotOnCvarHook);
+    HookConVarChange(gCvarList.LEVEL_DAMAGE_RATIO,       CvarsSnapshotOnCvarHook);
+    HookConVarChange(gCvarList.MESSAGES_DAMAGE,          CvarsSnapshotOnCvarHook);
+    HookConVarChange(gCvarList.MESSAGES_DAMAGE_INTERVAL, CvarsSnapshotOnCvarHook);
+    HookConVarChange(gCvarList.SEFFECTS_LEVEL,           CvarsSnapshotOnCvarHook);
+    HookConVarChange(gCvarList.SEFFECTS_FOOTSTEPS,       CvarsSnapshotOnCvarHook);
+    HookConVarChange(gCvarList.SEFFECTS_CLAWS,           CvarsSnapshotOnCvarHook);
+    HookConVarChange(gCvarList.SEFFECTS_BURN,            CvarsSnapshotOnCvarHook);
+    
+    // Load values
+    gCvarSnapshot.Update();
+}
+
+/**
+ * Cvar hook callback (zp_log*, zp_hitgroup, zp_knockback*, zp_level_*, zp_messages_damage*, zp_seffects_*)
+ * @brief Refreshes the snapshot of cvar values.
+ * 
+ * @param hConVar           The cvar handle.
+ * @param oldValue          The value before the attempted change.
+ * @param newValue          The new value.
+ **/
+public void CvarsSnapshotOnCvarHook(ConVar hConVar, char[] oldValue, char[] newValue)
+{
+    // Validate new value
+    if (!strcmp(oldValue, newValue, false))
+    {
+        return;
+    }
+    
+    // Load values
+    gCvarSnapshot.Update();
+}
+
+/**
+ * Console command callback (zp_cvars_reload)
+ * @brief Reloads and prints the snapshot of cvar values.
+ * 
+ * @param client            The client index.
+ * @param iArguments        The number of arguments that were in the argument string.
+ **/ 
+public Action CvarsReloadOnCommandCatched(int client, int iArguments)
+{
+    // Load values
+    gCvarSnapshot.Update();
+    
+    // Initialize variables
+    static char sBuffer[FILE_LINE_LENGTH]; sBuffer[0] = NULL_STRING[0];
+    static char sLine[BIG_LINE_LENGTH];
+
+    // Format strings
+    FormatEx(sLine, sizeof(sLine), "%24s: %d\n", "Log", gCvarSnapshot.Log);
+    StrCat(sBuffer, sizeof(sBuffer), sLine);
+    FormatEx(sLine, sizeof(sLine), "%24s: %d\n", "LogModuleFilter", gCvarSnapshot.LogModuleFilter);
+    StrCat(sBuffer, sizeof(sBuffer), sLine);
+    FormatEx(sLine, sizeof(sLine), "%24s: %d\n", "LogIgnoreConsole", gCvarSnapshot.LogIgnoreConsole);
+    StrCat(sBuffer, sizeof(sBuffer), sLine);
+    FormatEx(sLine, sizeof(sLine), "%24s: %d\n", "LogErrorOverride", gCvarSnapshot.LogErrorOverride);
+    StrCat(sBuffer, sizeof(sBuffer), sLine);
+    FormatEx(sLine, sizeof(sLine), "%24s: %d\n", "LogPrintChat", gCvarSnapshot.LogPrintChat);
+    StrCat(sBuffer, sizeof(sBuffer), sLine);
+    FormatEx(sLine, sizeof(sLine), "%24s: %d\n", "LogBuffer", gCvarSnapshot.LogBuffer);
+    StrCat(sBuffer, sizeof(sBuffer), sLine);
+    FormatEx(sLine, sizeof(sLine), "%24s: %d\n", "LogBufferSize", gCvarSnapshot.LogBufferSize);
+    StrCat(sBuffer, sizeof(sBuffer), sLine);
+    FormatEx(sLine, sizeof(sLine), "%24s: %.2f\n", "LogBufferLimit", gCvarSnapshot.LogBufferLimit);
+    StrCat(sBuffer, sizeof(sBuffer), sLine);
+    FormatEx(sLine, sizeof(sLine), "%24s: %d\n", "HitGroup", gCvarSnapshot.HitGroup);
+    StrCat(sBuffer, sizeof(sBuffer), sLine);
+    FormatEx(sLine, sizeof(sLine), "%24s: %d\n", "Knockback", gCvarSnapshot.Knockback);
+    StrCat(sBuffer, sizeof(sBuffer), sLine);
+    FormatEx(sLine, sizeof(sLine), "%24s: %.2f\n", "KnockbackAir", gCvarSnapshot.KnockbackAir);
+    StrCat(sBuffer, sizeof(sBuffer), sLine);
+    FormatEx(sLine, sizeof(sLine), "%24s: %d\n", "LevelSystem", gCvarSnapshot.LevelSystem);
+    StrCat(sBuffer, sizeof(sBuffer), sLine);
+    FormatEx(sLine, sizeof(sLine), "%24s: %.2f\n", "LevelHealthRatio", gCvarSnapshot.LevelHealthRatio);
+    StrCat(sBuffer, sizeof(sBuffer), sLine);
+    FormatEx(sLine, sizeof(sLine), "%24s: %.2f\n", "LevelSpeedRatio", gCvarSnapshot.LevelSpeedRatio);
+    StrCat(sBuffer, sizeof(sBuffer), sLine);
+    FormatEx(sLine, sizeof(sLine), "%24s: %.2f\n", "LevelGravityRatio", gCvarSnapshot.LevelGravityRatio);
+    StrCat(sBuffer, sizeof(sBuffer), sLine);
+    FormatEx(sLine, sizeof(sLine), "%24s: %.2f\n", "LevelDamageRatio", gCvarSnapshot.LevelDamageRatio);
+    StrCat(sBuffer, sizeof(sBuffer), sLine);
+    FormatEx(sLine, sizeof(sLine), "%24s: %d\n", "MessagesDamage", gCvarSnapshot.MessagesDamage);
+    StrCat(sBuffer, sizeof(sBuffer), sLine);
+    FormatEx(sLine, sizeof(sLine), "%24s: %.2f\n", "MessagesDamageInterval", gCvarSnapshot.MessagesDamageInterval);
+    StrCat(sBuffer, sizeof(sBuffer), sLine);
+    FormatEx(sLine, sizeof(sLine), "%24s: %d\n", "SoundLevel", gCvarSnapshot.SoundLevel);
+    StrCat(sBuffer, sizeof(sBuffer), sLine);
+    FormatEx(sLine, sizeof(sLine), "%24s: %d\n", "SoundFootsteps", gCvarSnapshot.SoundFootsteps);
+    StrCat(sBuffer, sizeof(sBuffer), sLine);
+    FormatEx(sLine, sizeof(sLine), "%24s: %d\n", "SoundClaws", gCvarSnapshot.SoundClaws);
+    StrCat(sBuffer, sizeof(sBuffer), sLine);
+    FormatEx(sLine, sizeof(sLine), "%24s: %d\n", "SoundBurn", gCvarSnapshot.SoundBurn);
+    StrCat(sBuffer, sizeof(sBuffer), sLine);
+    
+    // Send information into the console
+    ReplyToCommand(client, sBuffer);
+    return Plugin_Handled;
+}
+
 /**
  * @brief Prepare all cvar data.
  **/
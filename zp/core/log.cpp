@@ -50,7 +50,7 @@
  **/
 enum LogType
 {
-    LogType_Normal,               /** Normal log message. Printed in SourceMod logs. */
+    LogType_Normal,               /** Normal log message. Printed in SourceMod logs, or in the plugin log file when buffered. */
     LogType_Error,                /** Error message. Printed in SourceMod error logs. */
     LogType_Fatal,                /** Fatal error. Stops the plugin with the specified message. */
     LogType_Native,               /** Throws an error in the calling plugin of a native, instead of your own plugin. */
@@ -99,11 +99,32 @@ enum LogModule
  * @endsection
  **/
 
+/**
+ * @section Struct of a buffered log event.
+ **/
+enum struct LogEntry
+{
+    LogType Type;
+    LogModule Module;
+    int Time;
+    char Description[NORMAL_LINE_LENGTH];
+    char Message[FILE_LINE_LENGTH];
+}
+/**
+ * @endsection
+ **/
+ 
 /**
  * Cache of current module filter settings. For fast and easy access.
  **/
 bool LogModuleFilterCache[23/*LogModule*/];
 
+/**
+ * Cache of current module sampling rates and their event counters. (1 of N events is logged)
+ **/
+int LogModuleSampleCache[23/*LogModule*/];
+int LogModuleSampleCounter[23/*LogModule*/];
+
 /**
  * @brief List of modules that write log events. 
  **/
@@ -136,6 +157,21 @@ void LogOnInit(/*void*/)
     gServerData.Modules.SetValue("gamemodes", LogModule_GameModes);
     gServerData.Modules.SetValue("admin", LogModule_Admin);
     gServerData.Modules.SetValue("native", LogModule_Native);
+    
+    // Initialize a buffer array
+    gServerData.LogBuffer = new ArrayList(sizeof(LogEntry));
+    
+    // Starts the flush timer
+    LogOnFlushTimer();
+}
+
+/**
+ * @brief Log module unload function.
+ **/
+void LogOnUnload(/*void*/)
+{
+    // Write pending events
+    LogBufferFlush();
 }
 
 /**
@@ -147,6 +183,8 @@ void LogOnCommandInit(/*void*/)
     RegAdminCmd("zp_log_list", LogListOnCommandCatched, ADMFLAG_CONFIG, "List available logging flags and modules with their status values.");
     RegAdminCmd("zp_log_add_module", LogAddModuleOnCommandCatched, ADMFLAG_CONFIG, "Add one or more modules to the module filter. Usage: zp_log_add_module <module> [module] ...");
     RegAdminCmd("zp_log_remove_module", LogRemoveModuleOnCommandCatched, ADMFLAG_CONFIG, "Remove one or more modules from the module filter. Usage: zp_log_remove_module <module> [module] ...");
+    RegAdminCmd("zp_log_sample_module", LogSampleModuleOnCommandCatched, ADMFLAG_CONFIG, "Sets the sampling rate (1 of N events) of a module. Usage: zp_log_sample_module <module> <rate>");
+    RegAdminCmd("zp_log_flush", LogFlushOnCommandCatched, ADMFLAG_CONFIG, "Writes all buffered log events to the log file.");
 }
 
 /**
@@ -160,6 +198,81 @@ void LogOnCvarInit(/*void*/)
     gCvarList.LOG_IGNORE_CONSOLE = FindConVar("zp_log_ignore_console");
     gCvarList.LOG_ERROR_OVERRIDE = FindConVar("zp_log_error_override");
     gCvarList.LOG_PRINT_CHAT     = FindConVar("zp_log_print_chat");
+    gCvarList.LOG_BUFFER         = FindConVar("zp_log_buffer");
+    gCvarList.LOG_BUFFER_SIZE    = FindConVar("zp_log_buffer_size");
+    gCvarList.LOG_BUFFER_FLUSH   = FindConVar("zp_log_buffer_flush");
+    gCvarList.LOG_BUFFER_LIMIT   = FindConVar("zp_log_buffer_limit");
+    
+    // Hook cvars
+    HookConVarChange(gCvarList.LOG_BUFFER,       LogOnCvarHook);
+    HookConVarChange(gCvarList.LOG_BUFFER_FLUSH, LogOnCvarHook);
+}
+
+/**
+ * Cvar hook callback (zp_log_buffer, zp_log_buffer_flush)
+ * @brief Restarts the flush timer.
+ * 
+ * @param hConVar           The cvar handle.
+ * @param oldValue          The value before the attempted change.
+ * @param newValue          The new value.
+ **/
+public void LogOnCvarHook(ConVar hConVar, char[] oldValue, char[] newValue)
+{
+    // Validate new value
+    if (!strcmp(oldValue, newValue, false))
+    {
+        return;
+    }
+    
+    // Write pending events and restart the timer
+    LogBufferFlush();
+    LogOnFlushTimer();
+}
+
+/**
+ * @brief Creates the repeatable timer which writes buffered events.
+ **/
+void LogOnFlushTimer(/*void*/)
+{
+    // Validate buffer
+    if (gServerData.LogBuffer == null)
+    {
+        return;
+    }
+    
+    // Kill the previous timer
+    delete gServerData.LogTimer;
+    
+    // Gets the flush interval
+    float flInterval = gCvarList.LOG_BUFFER_FLUSH.FloatValue;
+    
+    // Validate mode
+    if (gCvarList.LOG_BUFFER.BoolValue && flInterval > 0.0)
+    {
+        // Timer lives through map changes, so do not use TIMER_FLAG_NO_MAPCHANGE here
+        gServerData.LogTimer = CreateTimer(flInterval, LogOnFlush, _, TIMER_REPEAT);
+    }
+}
+
+/**
+ * @brief Timer callback, writes buffered events to the log file.
+ *
+ * @param hTimer            The timer handle.
+ **/
+public Action LogOnFlush(Handle hTimer)
+{
+    // Write pending events
+    LogBufferFlush();
+    return Plugin_Continue;
+}
+
+/**
+ * @brief Frame callback, writes buffered events after the high-water mark was reached.
+ **/
+public void LogOnFlushPost(/*void*/)
+{
+    // Write pending events
+    LogBufferFlush();
 }
 
 /*
@@ -337,16 +450,17 @@ int LogGetModuleNameString(char[] sBuffer, int iMaxLen, LogModule iModule, bool
 void LogEvent(bool isConsole = false, LogType iType = LogType_Normal, int iEvent = LOG_CORE_EVENTS, LogModule iModule = LogModule_Config, char[] sDescription, char[] sMessage, any ...)
 {    
     // Check filter overrides. Always log fatal errors, and check error override setting on error log types
-    if ((iType != LogType_Fatal && iType != LogType_Error) || (iType == LogType_Error && !gCvarList.LOG_ERROR_OVERRIDE.BoolValue))
+    // Until the snapshot is loaded (module cvar init), every event is logged
+    if (gCvarSnapshot.Loaded && ((iType != LogType_Fatal && iType != LogType_Error) || (iType == LogType_Error && !gCvarSnapshot.LogErrorOverride)))
     {
         // Check iflogging is disabled
-        if (!gCvarList.LOG.BoolValue)
+        if (!gCvarSnapshot.Log)
         {
             return;
         }
 
         // Check if console is ignored
-        if (isConsole && gCvarList.LOG_IGNORE_CONSOLE.BoolValue)
+        if (isConsole && gCvarSnapshot.LogIgnoreConsole)
         {
             return;
         }
@@ -358,7 +472,7 @@ void LogEvent(bool isConsole = false, LogType iType = LogType_Normal, int iEvent
         }
 
         // Check ifmodule filtering is enabled
-        if (gCvarList.LOG_MODULE_FILTER.BoolValue)
+        if (gCvarSnapshot.LogModuleFilter)
         {
             // Check if the specified module is enabled
             if (!LogCheckModuleFilter(iModule))
@@ -368,10 +482,22 @@ void LogEvent(bool isConsole = false, LogType iType = LogType_Normal, int iEvent
         }
     }
 
+    // Check if the event should be sampled out
+    if (!LogCheckModuleSample(iType, iModule))
+    {
+        return;
+    }
+
     // Format extra parameters into the log buffer
     static char sLogBuffer[FILE_LINE_LENGTH];
     VFormat(sLogBuffer, sizeof(sLogBuffer), sMessage, 7);
 
+    // Buffered types are written later in one batch, prefix will be formatted on flush
+    if (LogBufferPush(iType, iModule, sDescription, sLogBuffer))
+    {
+        return;
+    }
+    
     // Gets human readable module name
     static char sModule[SMALL_LINE_LENGTH];
     LogGetModuleNameString(sModule, sizeof(sModule), iModule);
@@ -394,6 +520,8 @@ void LogEvent(bool isConsole = false, LogType iType = LogType_Normal, int iEvent
 
         case LogType_Fatal:
         {
+            // Write pending events before the plugin stops
+            LogBufferFlush();
             SetFailState(sLogBuffer);
         }
 
@@ -409,13 +537,161 @@ void LogEvent(bool isConsole = false, LogType iType = LogType_Normal, int iEvent
     }
 
     // Check if printing log events to public chat is enabled
-    if (gCvarList.LOG_PRINT_CHAT.BoolValue)
+    if (gCvarSnapshot.LogPrintChat)
     {
         // Print text to public chat
         PrintToChatAll(sLogBuffer);
     }
 }
 
+/**
+ * @brief Check if the event passes the sampling rate of its module.
+ *
+ * @param iType             The log type.
+ * @param iModule           The module of the event.
+ * @return                  True if the event should be logged, false otherwise.
+ **/
+bool LogCheckModuleSample(LogType iType, LogModule iModule)
+{
+    // Errors are never sampled
+    if (iType != LogType_Normal && iType != LogType_Command)
+    {
+        return true;
+    }
+    
+    // Gets the rate
+    int iRate = LogModuleSampleCache[iModule];
+    if (iRate <= 1)
+    {
+        return true;
+    }
+    
+    // Log only the first of each N events
+    return (LogModuleSampleCounter[iModule]++ % iRate) == 0;
+}
+
+/**
+ * @brief Pushes an event into the log buffer.
+ *
+ * @param iType             The log type.
+ * @param iModule           The module of the event.
+ * @param sDescription      The event description.
+ * @param sMessage          The formatted message.
+ * @return                  True if the event was consumed by the buffer, false to write it now.
+ **/
+bool LogBufferPush(LogType iType, LogModule iModule, char[] sDescription, char[] sMessage)
+{
+    // Only normal and command events are deferred
+    if (iType != LogType_Normal && iType != LogType_Command)
+    {
+        return false;
+    }
+    
+    // Validate buffer
+    if (gServerData.LogBuffer == null || !gCvarSnapshot.LogBuffer)
+    {
+        return false;
+    }
+    
+    // Check if the buffer is overflowed
+    int iSize = gServerData.LogBuffer.Length;
+    int iLimit = gCvarSnapshot.LogBufferSize;
+    if (iSize >= iLimit)
+    {
+        // Drop the event, but count it
+        gServerData.LogDropped++;
+        return true;
+    }
+    
+    // Store event
+    static LogEntry entry;
+    entry.Type = iType;
+    entry.Module = iModule;
+    entry.Time = GetTime();
+    strcopy(entry.Description, sizeof(entry.Description), sDescription);
+    strcopy(entry.Message, sizeof(entry.Message), sMessage);
+    gServerData.LogBuffer.PushArray(entry);
+    
+    // Reached the high-water mark ? Then flush on the next frame
+    if (!gServerData.LogPending && float(iSize + 1) >= float(iLimit) * gCvarSnapshot.LogBufferLimit)
+    {
+        gServerData.LogPending = true;
+        RequestFrame(LogOnFlushPost);
+    }
+    
+    // Return on success
+    return true;
+}
+
+/**
+ * @brief Writes all buffered events in one pass.
+ *
+ * @note Normal events go to the SourceMod log as before, command events go to the plugin log file.
+ **/
+void LogBufferFlush(/*void*/)
+{
+    // Resets the pending flag
+    gServerData.LogPending = false;
+    
+    // Validate buffer
+    int iSize = gServerData.LogBuffer != null ? gServerData.LogBuffer.Length : 0;
+    if (!iSize)
+    {
+        return;
+    }
+    
+    // Initialize variables
+    static LogEntry entry; bool bChat = gCvarSnapshot.LogPrintChat; File hFile = null;
+    static char sModule[SMALL_LINE_LENGTH]; static char sTime[SMALL_LINE_LENGTH];
+    static char sLogBuffer[FILE_LINE_LENGTH];
+    
+    // i = event index
+    for (int i = 0; i < iSize; i++)
+    {
+        // Gets event
+        gServerData.LogBuffer.GetArray(i, entry);
+        
+        // Gets human readable module name
+        LogGetModuleNameString(sModule, sizeof(sModule), entry.Module);
+        
+        // Format 
+        FormatEx(sLogBuffer, sizeof(sLogBuffer), "[%s] [%s] %s", sModule, entry.Description, entry.Message);
+        
+        // Validate type
+        if (entry.Type == LogType_Normal)
+        {
+            LogMessage(sLogBuffer);
+        }
+        else
+        {
+            // Opens the log file once for a whole batch
+            if (hFile == null) hFile = OpenFile(LOG_FILE, "a");
+            
+            // Validate file
+            if (hFile != null)
+            {
+                // Write the line with the time of the event
+                FormatTime(sTime, sizeof(sTime), "%m/%d/%Y - %H:%M:%S", entry.Time);
+                hFile.WriteLine("L %s: %s", sTime, sLogBuffer);
+            }
+        }
+        
+        // Check if printing log events to public chat is enabled
+        if (bChat)
+        {
+            // Print text to public chat
+            PrintToChatAll(sLogBuffer);
+        }
+    }
+    
+    // Close file
+    delete hFile;
+    
+    // Clear buffer
+    gServerData.LogBuffer.Clear();
+    gServerData.LogFlushed += iSize;
+}
+
 /**
  * @brief Adds a module to the module filter and updates the cache. If it already
  *        exist the command is ignored.
@@ -589,9 +865,13 @@ public Action LogListOnCommandCatched(int client, int iArguments)
     {
         LogGetModuleNameString(sModuleName, sizeof(sModuleName), view_as<LogModule>(i));
         LogGetModuleNameString(sPhraseShortName, sizeof(sPhraseShortName), view_as<LogModule>(i), true);
-        FormatEx(sLineBuffer, sizeof(sLineBuffer), "%-23s %-19s %s", sModuleName, sPhraseShortName, LogModuleFilterCache[i] ? "On" : "Off");
+        FormatEx(sLineBuffer, sizeof(sLineBuffer), "%-23s %-19s %-4s 1/%d", sModuleName, sPhraseShortName, LogModuleFilterCache[i] ? "On" : "Off", LogModuleSampleCache[i] > 1 ? LogModuleSampleCache[i] : 1);
         ReplyToCommand(client, sLineBuffer);
     }
+    
+    // Buffer status:
+    FormatEx(sLineBuffer, sizeof(sLineBuffer), "\nBuffer: %s | Pending: %d/%d | Flushed: %d | Dropped: %d", gCvarList.LOG_BUFFER.BoolValue ? "On" : "Off", gServerData.LogBuffer.Length, gCvarList.LOG_BUFFER_SIZE.IntValue, gServerData.LogFlushed, gServerData.LogDropped);
+    ReplyToCommand(client, sLineBuffer);
     return Plugin_Handled;
 }
 
@@ -692,3 +972,62 @@ public Action LogRemoveModuleOnCommandCatched(int client, int iArguments)
     LogModuleFilterCacheUpdate();
     return Plugin_Handled;
 }
+
+/**
+ * Console command callback (zp_log_sample_module)
+ * @brief Sets the sampling rate of a module.
+ * 
+ * @param client            The client index.
+ * @param iArguments        The number of arguments that were in the argument string.
+ **/
+public Action LogSampleModuleOnCommandCatched(int client, int iArguments)
+{
+    // Initialize some chars
+    static char sArgument[SMALL_LINE_LENGTH];
+    
+    // Check if no arguments
+    if (iArguments < 2)
+    {
+        // Display syntax info
+        ReplyToCommand(client, "Usage: zp_log_sample_module <module> <rate>");
+        return Plugin_Handled;
+    }
+    
+    // Gets rate
+    GetCmdArg(2, sArgument, sizeof(sArgument));
+    int iRate = StringToInt(sArgument);
+    
+    // Gets module
+    GetCmdArg(1, sArgument, sizeof(sArgument));
+    LogModule iModule = LogGetModule(sArgument);
+    
+    // Check ifinvalid
+    if (iModule == LogModule_Invalid)
+    {
+        TranslationReplyToCommand(client, "log module invalid name", sArgument);
+        return Plugin_Handled;
+    }
+    
+    // Sets rate and restart the counter
+    LogModuleSampleCache[iModule] = iRate > 1 ? iRate : 1;
+    LogModuleSampleCounter[iModule] = 0;
+    ReplyToCommand(client, "Module \"%s\" sampling rate: 1/%d", sArgument, LogModuleSampleCache[iModule]);
+    return Plugin_Handled;
+}
+
+/**
+ * Console command callback (zp_log_flush)
+ * @brief Writes all buffered log events.
+ * 
+ * @param client            The client index.
+ * @param iArguments        The number of arguments that were in the argument string.
+ **/
+public Action LogFlushOnCommandCatched(int client, int iArguments)
+{
+    // Write pending events
+    int iSize = gServerData.LogBuffer.Length;
+    LogBufferFlush();
+    
+    ReplyToCommand(client, "Flushed %d log events (dropped: %d)", iSize, gServerData.LogDropped);
+    return Plugin_Handled;
+}
@@ -0,0 +1,491 @@
+/**
+ * ============================================================================
+ *
+ *  Zombie Plague
+ *
+ *  File:          scheduler.cpp
+ *  Type:          Core
+ *  Description:   Think scheduler API. (timing wheel)
+ *
+ *  Copyright (C) 2015-2020 Nikita Ushakov (Ireland, Dublin)
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * ============================================================================
+ **/
+
+/**
+ * @section Properties of the timing wheel.
+ **/
+#define SCHEDULER_MAX_BITS     11                               /** Bits of the schedule slot in the think index. */
+#define SCHEDULER_MAX          (1 << SCHEDULER_MAX_BITS)        /** Max amount of active schedules. */
+#define SCHEDULER_WHEEL_BITS   6                                /** Bits of the wheel slot. */
+#define SCHEDULER_WHEEL_SLOTS  (1 << SCHEDULER_WHEEL_BITS)      /** Amount of slots per wheel level. */
+#define SCHEDULER_WHEEL_MASK   (SCHEDULER_WHEEL_SLOTS - 1)
+#define SCHEDULER_WHEEL_SPAN   (SCHEDULER_WHEEL_SLOTS * SCHEDULER_WHEEL_SLOTS)
+/**
+ * @endsection
+ **/
+
+/**
+ * @section Struct of operation types for schedule arrays.
+ **/
+enum struct ScheduleData
+{
+    Handle Plugin;                   /** Plugin which owns the think. */
+    Function Callback;               /** Function to call on the think. */
+    any Data;                        /** Data passed to the function. */
+    int Ref;                         /** Entity reference, or INVALID_ENT_REFERENCE. */
+    int Interval;                    /** Interval in the ticks. */
+    int Expire;                      /** Tick of the next think. */
+    int Serial;                      /** Serial of the slot usage. */
+    int Next;                        /** Next schedule in the wheel or free list. */
+    bool Active;                     /** True if the think was not cancelled. */
+}
+/**
+ * @endsection
+ **/
+
+/**
+ * Array to store the schedules.
+ **/
+ScheduleData gScheduleData[SCHEDULER_MAX]; int gSchedulerWheel[2][SCHEDULER_WHEEL_SLOTS]; int gSchedulerPhase[SCHEDULER_WHEEL_SLOTS];
+int gSchedulerFree; int gSchedulerTick; int gSchedulerCount;
+
+/**
+ * @brief Scheduler module init function.
+ **/
+void SchedulerOnInit(/*void*/)
+{
+    // Resets wheel
+    SchedulerOnPurge();
+}
+
+/**
+ * @brief Creates commands for scheduler module.
+ **/
+void SchedulerOnCommandInit(/*void*/)
+{
+    // Hook commands
+    RegAdminCmd("zp_schedule_stats", SchedulerOnCommandCatched, ADMFLAG_CONFIG, "Prints the active schedules per plugin.");
+}
+
+/**
+ * @brief Scheduler module purge function.
+ **/
+void SchedulerOnPurge(/*void*/)
+{
+    // i = wheel slot
+    for (int i = 0; i < SCHEDULER_WHEEL_SLOTS; i++)
+    {
+        // Clear slots
+        gSchedulerWheel[0][i] = -1;
+        gSchedulerWheel[1][i] = -1;
+        gSchedulerPhase[i] = 0;
+    }
+
+    // i = schedule index
+    for (int i = 0; i < SCHEDULER_MAX; i++)
+    {
+        // Chain free slots
+        gScheduleData[i].Active = false;
+        gScheduleData[i].Next = (i + 1 < SCHEDULER_MAX) ? (i + 1) : -1;
+    }
+
+    // Resets variables
+    gSchedulerFree = 0;
+    gSchedulerTick = 0;
+    gSchedulerCount = 0;
+}
+
+/**
+ * @brief Called when a plugin is unloaded.
+ *
+ * @param hPlugin           The plugin handle.
+ **/
+void SchedulerOnPluginUnload(Handle hPlugin)
+{
+    // i = schedule index
+    for (int i = 0; i < SCHEDULER_MAX; i++)
+    {
+        // Validate owner
+        if (gScheduleData[i].Active && gScheduleData[i].Plugin == hPlugin)
+        {
+            // Cancel think
+            gScheduleData[i].Active = false;
+            gSchedulerCount--;
+        }
+    }
+}
+
+/**
+ * Console command callback (zp_schedule_stats)
+ * @brief Prints the active schedules per plugin.
+ *
+ * @param client            The client index.
+ * @param iArguments        The number of arguments that were in the argument string.
+ **/
+public Action SchedulerOnCommandCatched(int client, int iArguments)
+{
+    // Initialize variables
+    static char sBuffer[HUGE_LINE_LENGTH]; sBuffer[0] = NULL_STRING[0];
+    static char sLine[BIG_LINE_LENGTH]; static char sName[NORMAL_LINE_LENGTH];
+
+    // Create array of plugins
+    ArrayList hList = new ArrayList(2);
+
+    // i = schedule index
+    for (int i = 0; i < SCHEDULER_MAX; i++)
+    {
+        // Validate think
+        if (!gScheduleData[i].Active)
+        {
+            continue;
+        }
+
+        // Find plugin
+        int iD = hList.FindValue(gScheduleData[i].Plugin);
+        if (iD == -1)
+        {
+            iD = hList.Push(gScheduleData[i].Plugin);
+            hList.Set(iD, 0, 1);
+        }
+
+        // Update the counter
+        hList.Set(iD, hList.Get(iD, 1) + 1, 1);
+    }
+
+    // i = plugin index
+    int iSize = hList.Length;
+    for (int i = 0; i < iSize; i++)
+    {
+        // Gets plugin name
+        GetPluginFilename(hList.Get(i), sName, sizeof(sName));
+
+        // Format strings
+        FormatEx(sLine, sizeof(sLine), "%24s: %d\n", sName, hList.Get(i, 1));
+        StrCat(sBuffer, sizeof(sBuffer), sLine);
+    }
+
+    // Format strings
+    FormatEx(sLine, sizeof(sLine), "%24s: %d\n", "Total", gSchedulerCount);
+    StrCat(sBuffer, sizeof(sBuffer), sLine);
+
+    // Delete list
+    delete hList;
+
+    // Send information into the console
+    ReplyToCommand(client, sBuffer);
+    return Plugin_Handled;
+}
+
+/**
+ * @brief Called before every server frame.
+ **/
+void SchedulerOnFrame(/*void*/)
+{
+    // Move the wheel
+    int iTick = ++gSchedulerTick;
+
+    // Validate the next block
+    if (!(iTick & SCHEDULER_WHEEL_MASK))
+    {
+        // Cascade the upper level into the lower one
+        int iD = SchedulerDetach(1, (iTick >> SCHEDULER_WHEEL_BITS) & SCHEDULER_WHEEL_MASK);
+        while (iD != -1)
+        {
+            int iNext = gScheduleData[iD].Next;
+            SchedulerInsert(iD);
+            iD = iNext;
+        }
+    }
+
+    // Execute thinks of the current slot
+    int iD = SchedulerDetach(0, iTick & SCHEDULER_WHEEL_MASK);
+    while (iD != -1)
+    {
+        int iNext = gScheduleData[iD].Next;
+        SchedulerOnThink(iD, iTick);
+        iD = iNext;
+    }
+}
+
+/**
+ * @brief Executes the expired think.
+ *
+ * @param iD                The schedule index.
+ * @param iTick             The current tick.
+ **/
+void SchedulerOnThink(int iD, int iTick)
+{
+    // Validate cancelled
+    if (!gScheduleData[iD].Active)
+    {
+        SchedulerFree(iD);
+        return;
+    }
+
+    // Validate clamped
+    if (gScheduleData[iD].Expire > iTick)
+    {
+        SchedulerInsert(iD);
+        return;
+    }
+
+    // Gets entity index from reference key
+    int entity = -1;
+    if (gScheduleData[iD].Ref != INVALID_ENT_REFERENCE)
+    {
+        entity = EntRefToEntIndex(gScheduleData[iD].Ref);
+
+        // Cancel if entity was removed
+        if (entity == -1)
+        {
+            gScheduleData[iD].Active = false;
+            gSchedulerCount--;
+            SchedulerFree(iD);
+            return;
+        }
+    }
+
+    // Call the think
+    Action hResult = Plugin_Continue;
+    Call_StartFunction(gScheduleData[iD].Plugin, gScheduleData[iD].Callback);
+    Call_PushCell(entity);
+    Call_PushCell(gScheduleData[iD].Data);
+    Call_Finish(hResult);
+
+    // Validate cancelled inside the think
+    if (!gScheduleData[iD].Active)
+    {
+        SchedulerFree(iD);
+        return;
+    }
+
+    // Validate stop
+    if (hResult == Plugin_Stop)
+    {
+        gScheduleData[iD].Active = false;
+        gSchedulerCount--;
+        SchedulerFree(iD);
+        return;
+    }
+
+    // Schedule the next think without drift
+    gScheduleData[iD].Expire += gScheduleData[iD].Interval;
+    SchedulerInsert(iD);
+}
+
+/*
+ * Scheduler natives API.
+ */
+
+/**
+ * @brief Sets up natives for library.
+ **/
+void SchedulerOnNativeInit(/*void*/)
+{
+    CreateNative("ZP_ScheduleThink", API_ScheduleThink);
+    CreateNative("ZP_CancelThink",   API_CancelThink);
+}
+
+/**
+ * @brief Schedules the repeating think.
+ *
+ * @note native int ZP_ScheduleThink(entityRef, interval, callback, data, spread);
+ **/
+public int API_ScheduleThink(Handle hPlugin, int iNumParams)
+{
+    // Gets entity index from native cell
+    int refID = GetNativeCell(1);
+
+    // Validate entity
+    if (refID != INVALID_ENT_REFERENCE)
+    {
+        int entity = EntRefToEntIndex(refID);
+        if (entity == -1)
+        {
+            LogEvent(false, LogType_Native, LOG_CORE_EVENTS, LogModule_Engine, "Native Validation", "Invalid the entity reference (%d)", refID);
+            return -1;
+        }
+
+        // Gets reference key
+        refID = EntIndexToEntRef(entity);
+    }
+
+    // Gets interval from native cell
+    float flInterval = GetNativeCell(2);
+
+    // Validate interval
+    if (flInterval <= 0.0)
+    {
+        LogEvent(false, LogType_Native, LOG_CORE_EVENTS, LogModule_Engine, "Native Validation", "Invalid the think interval (%.2f)", flInterval);
+        return -1;
+    }
+
+    // Return the value
+    return SchedulerCreate(hPlugin, GetNativeFunction(3), GetNativeCell(4), refID, flInterval, GetNativeCell(5));
+}
+
+/**
+ * @brief Cancels the think.
+ *
+ * @note native void ZP_CancelThink(think);
+ **/
+public int API_CancelThink(Handle hPlugin, int iNumParams)
+{
+    // Cancel the think
+    SchedulerCancel(GetNativeCell(1));
+    return 0;
+}
+
+/*
+ * Stocks scheduler API.
+ */
+
+/**
+ * @brief Creates the repeating think.
+ *
+ * @param hPlugin           The plugin handle.
+ * @param hCallback         The think function.
+ * @param iData             The data passed to the function.
+ * @param refID             The entity reference, or INVALID_ENT_REFERENCE.
+ * @param flInterval        The interval in the seconds.
+ * @param bSpread           True to delay the first think by a phase inside the next interval.
+ * @return                  The think index, or -1 if all slots are used.
+ **/
+int SchedulerCreate(Handle hPlugin, Function hCallback, any iData, int refID, float flInterval, bool bSpread)
+{
+    // Validate free slot
+    int iD = gSchedulerFree;
+    if (iD == -1)
+    {
+        LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Engine, "Scheduler", "Reached the max amount of schedules (%d)", SCHEDULER_MAX);
+        return -1;
+    }
+    gSchedulerFree = gScheduleData[iD].Next;
+
+    // Gets interval in the ticks
+    int iInterval = RoundToCeil(flInterval / GetTickInterval());
+    if (iInterval < 1) iInterval = 1;
+
+    // Gets the first think offset
+    int iOffset = iInterval;
+    if (bSpread)
+    {
+        /// Threads with the same interval are shifted to different ticks, never earlier than one interval
+        iOffset += gSchedulerPhase[iInterval & SCHEDULER_WHEEL_MASK]++ % iInterval;
+    }
+
+    // Sets schedule data
+    gScheduleData[iD].Plugin   = hPlugin;
+    gScheduleData[iD].Callback = hCallback;
+    gScheduleData[iD].Data     = iData;
+    gScheduleData[iD].Ref      = refID;
+    gScheduleData[iD].Interval = iInterval;
+    gScheduleData[iD].Expire   = gSchedulerTick + iOffset;
+    gScheduleData[iD].Serial   = (gScheduleData[iD].Serial + 1) & 0xFFFFF;
+    gScheduleData[iD].Active   = true;
+    gSchedulerCount++;
+
+    // Push into the wheel
+    SchedulerInsert(iD);
+
+    // Return the think index
+    return (gScheduleData[iD].Serial << SCHEDULER_MAX_BITS) | iD;
+}
+
+/**
+ * @brief Cancels the think.
+ *
+ * @param iThink            The think index.
+ **/
+void SchedulerCancel(int iThink)
+{
+    // Validate index
+    if (iThink < 0)
+    {
+        return;
+    }
+
+    // Gets schedule slot
+    int iD = iThink & (SCHEDULER_MAX - 1);
+
+    // Validate serial
+    if (gScheduleData[iD].Active && gScheduleData[iD].Serial == (iThink >> SCHEDULER_MAX_BITS))
+    {
+        /// Slot is released when the wheel reaches it
+        gScheduleData[iD].Active = false;
+        gSchedulerCount--;
+    }
+}
+
+/**
+ * @brief Pushes the schedule into the wheel.
+ *
+ * @param iD                The schedule index.
+ **/
+void SchedulerInsert(int iD)
+{
+    // Gets delta of the think
+    int iExpire = gScheduleData[iD].Expire;
+    int iDelta = iExpire - gSchedulerTick;
+
+    // Find the wheel level/slot
+    int iLevel; int iSlot;
+    if (iDelta < SCHEDULER_WHEEL_SLOTS)
+    {
+        iSlot = iExpire & SCHEDULER_WHEEL_MASK;
+    }
+    else if (iDelta < SCHEDULER_WHEEL_SPAN)
+    {
+        iLevel = 1;
+        iSlot = (iExpire >> SCHEDULER_WHEEL_BITS) & SCHEDULER_WHEEL_MASK;
+    }
+    else
+    {
+        /// Long thinks are reinserted from the farthest slot
+        iLevel = 1;
+        iSlot = ((gSchedulerTick >> SCHEDULER_WHEEL_BITS) + SCHEDULER_WHEEL_MASK) & SCHEDULER_WHEEL_MASK;
+    }
+
+    // Link into the slot
+    gScheduleData[iD].Next = gSchedulerWheel[iLevel][iSlot];
+    gSchedulerWheel[iLevel][iSlot] = iD;
+}
+
+/**
+ * @brief Detaches the list from the wheel slot.
+ *
+ * @param iLevel            The wheel level.
+ * @param iSlot             The wheel slot.
+ * @return                  The first schedule index.
+ **/
+int SchedulerDetach(int iLevel, int iSlot)
+{
+    int iD = gSchedulerWheel[iLevel][iSlot];
+    gSchedulerWheel[iLevel][iSlot] = -1;
+    return iD;
+}
+
+/**
+ * @brief Returns the schedule slot to the free list.
+ *
+ * @param iD                The schedule index.
+ **/
+void SchedulerFree(int iD)
+{
+    gScheduleData[iD].Next = gSchedulerFree;
+    gSchedulerFree = iD;
+}
@@ -180,7 +180,7 @@ stock void TranslationPrintHintText(int client, any ...)
         VFormat(sTranslation, CHAT_LINE_LENGTH, "%t", 2);
 
         // Print translated phrase to the client screen
-        UTIL_CreateClientHint(client, sTranslation);
+        TranslationSendHint(client, sTranslation);
     }
 }
 
@@ -211,11 +211,36 @@ stock void TranslationPrintHintTextAll(any ...)
             VFormat(sTranslation, CHAT_LINE_LENGTH, "%t", 1);
             
             // Print translated phrase to the client screen
-            UTIL_CreateClientHint(i, sTranslation);
+            TranslationSendHint(i, sTranslation);
         }
     }
 }
 
+/**
+ * @brief Sends hint center text to the client.
+ *
+ * @note Html text is sent in the final form, so the hint hook doesn't re-send it.
+ *
+ * @param client            The client index.
+ * @param sMessage          The message text.
+ **/
+stock void TranslationSendHint(int client, char[] sMessage)
+{
+    // Validate html tags
+    if (ToolsIsHintHtml(sMessage))
+    {
+        // Initialize recipient
+        int iPlayers[1]; iPlayers[0] = client;
+
+        // Print html text to the client screen
+        ToolsPrintHintHtml(iPlayers, 1, sMessage);
+        return;
+    }
+
+    // Print text to the client screen
+    UTIL_CreateClientHint(client, sMessage);
+}
+
 /**
  * @brief Print hud text to the client.
  * 
@@ -66,11 +66,26 @@ enum struct ServerData
     
     /* Timer */
     Handle CounterTimer;
+    Handle HealthTimer;
+    
+    /* Logs */
+    ArrayList LogBuffer;
+    Handle LogTimer;
+    bool LogPending;
+    int LogFlushed;
+    int LogDropped;
     
     /* Sounds */
     Handle EndTimer; 
     Handle BlastTimer;
     
+    /* Messages */
+    ArrayList MessageBlocks;
+    ArrayList MessagePrefixes;
+    StringMap MessageKeys;
+    ArrayList HintQueue;
+    int HintResent;
+    
     /* Gamedata */
     GameData Config;
     GameData SDKHooks;
@@ -100,13 +115,20 @@ enum struct ServerData
     ArrayList Weapons;
     ArrayList Downloads;
     ArrayList Sounds;
+    ArrayList SoundLimits;
     ArrayList Levels;
     StringMap Configs;
     StringMap Modules;
+    StringMap Templates;
     
     /* Weapons */
     int Melee;
     StringMap Market;
+    
+    /* Limits */
+    ArrayList ItemLimits;
+    ArrayList WeaponLimits;
+    int LimitEpoch;
 
     /**
      * @brief Clear all timers.
@@ -114,6 +136,7 @@ enum struct ServerData
     void PurgeTimers(/*void*/)
     {
         this.CounterTimer = null;
+        this.HealthTimer  = null;
         this.EndTimer     = null;
         this.BlastTimer   = null;
     }
@@ -122,6 +145,18 @@ enum struct ServerData
  * @endsection
  **/
 
+/**
+ * @section Purchase limit table blocks.
+ **/
+enum
+{
+    LIMITS_DATA_COUNT,
+    LIMITS_DATA_EPOCH
+};
+/**
+ * @endsection
+ **/
+
 /**
  * Array to store the server data.
  **/
@@ -145,6 +180,8 @@ enum struct ClientData
     int RespawnTimes;
     int Money;
     int LastPurchase;
+    int ItemEpoch;
+    int WeaponEpoch;
     int Level;
     int Exp;
     int Costume;
@@ -183,7 +220,6 @@ enum struct ClientData
     Handle SkillTimer;
     Handle CounterTimer;
     Handle HealTimer;
-    Handle SpriteTimer;
     Handle MoanTimer;
     Handle AmbientTimer;
     Handle BuyTimer;
@@ -192,8 +228,6 @@ enum struct ClientData
     /* Arrays */
     ArrayList ShoppingCart;
     ArrayList DefaultCart;
-    StringMap ItemLimit;
-    StringMap WeaponLimit;
     
     /**
      * @brief Resets all variables.
@@ -212,6 +246,8 @@ enum struct ClientData
         this.RespawnTimes         = 0;
         this.Money                = 0;
         this.LastPurchase         = 0;
+        this.ItemEpoch            = 0;
+        this.WeaponEpoch          = 0;
         this.Level                = 1;
         this.Exp                  = 0;
         this.Costume              = -1;
@@ -255,8 +291,6 @@ enum struct ClientData
        
         delete this.ShoppingCart;
         delete this.DefaultCart;
-        delete this.ItemLimit;
-        delete this.WeaponLimit;
     }
     
     /**
@@ -270,7 +304,6 @@ enum struct ClientData
         delete this.SkillTimer;
         delete this.CounterTimer;
         delete this.HealTimer;
-        delete this.SpriteTimer;
         delete this.MoanTimer;
         delete this.AmbientTimer;
         delete this.BuyTimer;
@@ -288,7 +321,6 @@ enum struct ClientData
         this.SkillTimer   = null;
         this.CounterTimer = null;
         this.HealTimer    = null;
-        this.SpriteTimer  = null;
         this.MoanTimer    = null; 
         this.AmbientTimer = null; 
         this.BuyTimer     = null;
@@ -324,4 +356,16 @@ public void OnEntityCreated(int entity, const char[] sClassname)
     // Forward event to modules
     WeaponOnEntityCreated(entity, sClassname);
     HitGroupsOnEntityCreated(entity, sClassname);
+    SoundsOnEntityCreated(entity, sClassname);
+}
+
+/**
+ * @brief Called when an entity is destroyed.
+ *
+ * @param entity            The entity index.
+ **/
+public void OnEntityDestroyed(int entity)
+{
+    // Forward event to modules
+    SoundsOnEntityDestroyed(entity);
 }
\ No newline at end of file
@@ -143,6 +143,8 @@ enum AnimType
 #include "zp/manager/playerclasses/runcmd.cpp"
 #include "zp/manager/playerclasses/antistick.cpp"
 #include "zp/manager/playerclasses/account.cpp"
+#include "zp/manager/playerclasses/ledger.cpp"
+#include "zp/manager/playerclasses/attachpool.cpp"
 #include "zp/manager/playerclasses/spawn.cpp"
 #include "zp/manager/playerclasses/death.cpp"
 #include "zp/manager/playerclasses/apply.cpp"
@@ -159,6 +161,7 @@ void ClassesOnInit(/*void*/)
     // Forward event to sub-modules
     ToolsOnInit();
     SpawnOnInit();
+    AttachPoolOnInit();
     DeathOnInit();
     JumpBoostOnInit();
     AccountOnInit();
@@ -172,6 +175,16 @@ void ClassesOnPurge(/*void*/)
 {
     // Forward event to sub-modules
     ToolsOnPurge();
+    SpawnOnPurge();
+}
+
+/**
+ * @brief Classes module frame function.
+ **/
+void ClassesOnFrame(/*void*/)
+{
+    // Forward event to sub-modules
+    SpawnOnFrame();
 }
 
 /**
@@ -252,6 +265,9 @@ void ClassesOnCacheData(/*void*/)
         gServerData.Types.Clear();
     }
     
+    // Clear out the menu templates
+    MenusClearTemplates();
+    
     // Validate size
     int iSize = gServerData.Classes.Length;
     if (!iSize)
@@ -425,6 +441,7 @@ void ClassesOnUnload(/*void*/)
 {
     // Forward event to sub-modules
     ToolsOnUnload();
+    AttachPoolOnUnload();
 }
 
 /**
@@ -443,6 +460,8 @@ void ClassesOnCommandInit(/*void*/)
 {
     // Forward event to sub-modules
     AccountOnCommandInit();
+    LedgerOnCommandInit();
+    AttachPoolOnCommandInit();
     ZTeleOnCommandsCreate();
     AntiStickOnCommandInit();
     ClassMenusOnCommandInit();
@@ -494,6 +513,18 @@ void ClassesOnClientConnect(int client)
     ToolsOnClientConnect(client);
 }
 
+/**
+ * @brief Called when a client is disconnecting from the server.
+ *
+ * @param client            The client index.
+ **/
+void ClassesOnClientDisconnect(int client)
+{
+    // Forward event to sub-modules
+    LedgerOnClientDisconnect(client);
+    AttachPoolOnClientDisconnect(client);
+}
+
 /**
  * @brief Called when a client is disconnected from the server.
  *
@@ -581,6 +612,7 @@ void ClassesOnNativeInit(/*void*/)
     SkillSystemOnNativeInit();
     LevelSystemOnNativeInit();
     AccountOnNativeInit();
+    SpawnOnNativeInit();
 }
 
 /**
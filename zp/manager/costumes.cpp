@@ -176,6 +176,9 @@ void CostumesOnCacheData(/*void*/)
         return;
     }
 
+    // Clear out the menu templates
+    MenusClearTemplates();
+    
     // Validate size
     int iSize = gServerData.Costumes.Length;
     if (!iSize)
@@ -994,10 +997,10 @@ void CostumesMenu(int client)
 
     // Initialize variables
     static char sBuffer[NORMAL_LINE_LENGTH];
-    static char sName[SMALL_LINE_LENGTH];
     static char sInfo[SMALL_LINE_LENGTH];
-    static char sLevel[SMALL_LINE_LENGTH];
-    static char sGroup[SMALL_LINE_LENGTH];
+    
+    // Gets menu template
+    ArrayList hTemplate = MenusGetTemplate(client, MenuTemplate_Costumes); MenuRow hRow;
     
     // Creates menu handle
     Menu hMenu = new Menu(CostumesMenuSlots);
@@ -1017,12 +1020,16 @@ void CostumesMenu(int client)
     // Initialize forward
     Action hResult;
     
-    // i = array index
-    int iSize = gServerData.Costumes.Length; int iAmount;
+    // i = row index
+    int iSize = hTemplate.Length; int iAmount;
     for (int i = 0; i < iSize; i++)
     {
+        // Gets row data
+        hTemplate.GetArray(i, hRow, sizeof(hRow));
+        int iD = hRow.ID;
+        
         // Call forward
-        gForwardData._OnClientValidateCostume(client, i, hResult);
+        gForwardData._OnClientValidateCostume(client, iD, hResult);
         
         // Skip, if class is disabled
         if (hResult == Plugin_Stop)
@@ -1030,17 +1037,15 @@ void CostumesMenu(int client)
             continue;
         }
         
-        // Gets costume data
-        CostumesGetName(i, sName, sizeof(sName));
-        CostumesGetGroup(i, sGroup, sizeof(sGroup));
+        // Gets client conditions
+        bool bGroup = (hasLength(hRow.Group) && !IsPlayerInGroup(client, hRow.Group));
         
         // Format some chars for showing in menu
-        FormatEx(sLevel, sizeof(sLevel), "%t", "level", CostumesGetLevel(i));
-        FormatEx(sBuffer, sizeof(sBuffer), "%t  %s", sName, (hasLength(sGroup) && !IsPlayerInGroup(client, sGroup)) ? sGroup : (gClientData[client].Level < CostumesGetLevel(i)) ? sLevel : "");
+        FormatEx(sBuffer, sizeof(sBuffer), "%s  %s", hRow.Name, bGroup ? hRow.Group : (gClientData[client].Level < hRow.Level) ? hRow.LevelInfo : "");
 
         // Show option
-        IntToString(i, sInfo, sizeof(sInfo));
-        hMenu.AddItem(sInfo, sBuffer, MenusGetItemDraw((hResult == Plugin_Handled || (hasLength(sGroup) && !IsPlayerInGroup(client, sGroup)) || gClientData[client].Level < CostumesGetLevel(i) || gClientData[client].Costume == i) ? false : true));
+        IntToString(iD, sInfo, sizeof(sInfo));
+        hMenu.AddItem(sInfo, sBuffer, MenusGetItemDraw((hResult == Plugin_Handled || bGroup || gClientData[client].Level < hRow.Level || gClientData[client].Costume == iD) ? false : true));
     
         // Increment amount
         iAmount++;
@@ -1062,6 +1067,31 @@ void CostumesMenu(int client)
     hMenu.Display(client, MENU_TIME_FOREVER); 
 }
 
+/**
+ * @brief Fills the costumes menu template.
+ *  
+ * @param hTemplate         The array of rows.
+ **/ 
+void CostumesMenuTemplate(ArrayList hTemplate)
+{
+    // Initialize variables
+    static char sName[SMALL_LINE_LENGTH];
+    static char sGroup[SMALL_LINE_LENGTH]; MenuRow hRow;
+    
+    // i = array index
+    int iSize = gServerData.Costumes.Length;
+    for (int i = 0; i < iSize; i++)
+    {
+        // Gets costume data
+        CostumesGetName(i, sName, sizeof(sName));
+        CostumesGetGroup(i, sGroup, sizeof(sGroup));
+        
+        // Push row into array
+        MenusSetTemplateRow(hRow, i, sName, sGroup, _, CostumesGetLevel(i));
+        hTemplate.PushArray(hRow, sizeof(hRow));
+    }
+}
+
 /**
  * @brief Called when client selects option in the main menu, and handles it.
  *  
@@ -1200,8 +1230,8 @@ void CostumesCreateEntity(int client)
         static char sModel[PLATFORM_LINE_LENGTH];
         CostumesGetModel(gClientData[client].Costume, sModel, sizeof(sModel));
         
-        // Creates an attach addon entity 
-        int entity = UTIL_CreateDynamic("costume", NULL_VECTOR, NULL_VECTOR, sModel);
+        // Gets an attach addon entity from the pool
+        int entity = AttachPoolAcquire(client, ATTACHPOOL_SLOT_COSTUME, "costume", sModel, CostumesIsHide(gClientData[client].Costume));
         
         // If entity isn't valid, then skip
         if (entity != -1)
@@ -1209,11 +1239,6 @@ void CostumesCreateEntity(int client)
             // Sets bodygroup/skin for the entity
             ToolsSetTextures(entity, CostumesGetBody(gClientData[client].Costume), CostumesGetSkin(gClientData[client].Costume)); 
 
-            // Sets parent to the entity
-            SetVariantString("!activator");
-            AcceptEntityInput(entity, "SetParent", client, entity);
-            ToolsSetOwner(entity, client);
-
             // Gets costume attachment
             static char sAttach[SMALL_LINE_LENGTH];
             CostumesGetAttach(gClientData[client].Costume, sAttach, sizeof(sAttach)); 
@@ -1257,9 +1282,6 @@ void CostumesCreateEntity(int client)
         
             // Validate merging
             if (CostumesIsMerge(gClientData[client].Costume)) CostumesBoneMerge(entity);
-
-            // Hook entity callbacks
-            if (CostumesIsHide(gClientData[client].Costume)) SDKHook(entity, SDKHook_SetTransmit, ToolsOnEntityTransmit);
             
             // Store the client cache
             gClientData[client].AttachmentCostume = EntIndexToEntRef(entity);
@@ -1293,12 +1315,9 @@ void CostumesBoneMerge(int entity)
  **/
 void CostumesRemove(int client)
 {
-    // Gets current costume from the client reference
-    int entity = EntRefToEntIndex(gClientData[client].AttachmentCostume);
-
-    // Validate costume
-    if (entity != -1) 
-    {
-        AcceptEntityInput(entity, "Kill"); /// Destroy
-    }
+    // Hide current costume for the next reuse
+    AttachPoolRelease(client, ATTACHPOOL_SLOT_COSTUME);
+    
+    // Clear the client cache
+    gClientData[client].AttachmentCostume = -1;
 }
\ No newline at end of file
@@ -105,6 +105,9 @@ void ExtraItemsOnCacheData(/*void*/)
         return;
     }
     
+    // Clear out the menu templates
+    MenusClearTemplates();
+    
     // Validate size
     int iSize = gServerData.ExtraItems.Length;
     if (!iSize)
@@ -112,6 +115,9 @@ void ExtraItemsOnCacheData(/*void*/)
         LogEvent(false, LogType_Fatal, LOG_GAME_EVENTS, LogModule_ExtraItems, "Config Validation", "No usable data found in extraitems config file: \"%s\"", sPathItems);
         return;
     }
+    
+    // Creates buy limit table
+    ItemsCreateLimits(iSize);
 
     // i = array index
     for (int i = 0; i < iSize; i++)
@@ -681,21 +687,66 @@ int ItemsGetLimit(int iD)
 }
 
 /**
- * @brief Remove the buy limit of the all client items.
+ * @brief Creates the buy limit table of the all client items.
  *
- * @param client            The client index.
+ * @note The existing counters are kept when the table is rebuilt.
+ *
+ * @param iSize             The amount of items.
  **/
-void ItemsRemoveLimits(int client)
+void ItemsCreateLimits(int iSize)
 {
-    // If array hasn't been created, then create
-    if (gClientData[client].ItemLimit == null)
+    // Gets the size of the current table
+    int iOldSize = (gServerData.ItemLimits != null) ? gServerData.ItemLimits.Length / (MAXPLAYERS + 1) : -1;
+    
+    // Validate size, the counters are kept on reload
+    if (iOldSize == iSize)
     {
-        // Initialize a buy limit array
-        gClientData[client].ItemLimit = new StringMap();
+        return;
     }
+    
+    // Initialize a buy limit table with one counter per client and item
+    ArrayList hLimits = new ArrayList(2, iSize * (MAXPLAYERS + 1));
+    
+    // i = client index
+    for (int i = 0; i <= MAXPLAYERS; i++)
+    {
+        // x = item index
+        for (int x = 0; x < iSize; x++)
+        {
+            // Gets counter index
+            int iIndex = i * iSize + x;
+            
+            // Copy the existing counter
+            if (x < iOldSize)
+            {
+                int iOldIndex = i * iOldSize + x;
+                hLimits.Set(iIndex, gServerData.ItemLimits.Get(iOldIndex, LIMITS_DATA_COUNT), LIMITS_DATA_COUNT);
+                hLimits.Set(iIndex, gServerData.ItemLimits.Get(iOldIndex, LIMITS_DATA_EPOCH), LIMITS_DATA_EPOCH);
+            }
+            else
+            {
+                hLimits.Set(iIndex, 0, LIMITS_DATA_COUNT);
+                hLimits.Set(iIndex, 0, LIMITS_DATA_EPOCH);
+            }
+        }
+    }
+    
+    // Replace the table
+    delete gServerData.ItemLimits;
+    gServerData.ItemLimits = hLimits;
+}
 
-    // Clear out the array of all data
-    gClientData[client].ItemLimit.Clear();
+/**
+ * @brief Remove the buy limit of the all client items.
+ *
+ * @note Counters of the previous epoch are treated as zero.
+ *
+ * @param client            The client index.
+ **/
+void ItemsRemoveLimits(int client)
+{
+    // Sets the new epoch
+    gClientData[client].ItemEpoch = ++gServerData.LimitEpoch;
 }
 
 /**
@@ -707,19 +758,18 @@ void ItemsRemoveLimits(int client)
  **/
 void ItemsSetLimits(int client, int iD, int iLimit)
 {
-    // If array hasn't been created, then create
-    if (gClientData[client].ItemLimit == null)
+    // If epoch hasn't been started, then start
+    if (!gClientData[client].ItemEpoch)
     {
-        // Initialize a buy limit array
-        gClientData[client].ItemLimit = new StringMap();
+        ItemsRemoveLimits(client);
     }
 
-    // Initialize key char
-    static char sKey[SMALL_LINE_LENGTH];
-    IntToString(iD, sKey, sizeof(sKey));
+    // Gets counter index
+    int iIndex = client * gServerData.ExtraItems.Length + iD;
     
     // Sets buy limit for the client
-    gClientData[client].ItemLimit.SetValue(sKey, iLimit);
+    gServerData.ItemLimits.Set(iIndex, iLimit, LIMITS_DATA_COUNT);
+    gServerData.ItemLimits.Set(iIndex, gClientData[client].ItemEpoch, LIMITS_DATA_EPOCH);
 }
 
 /**
@@ -730,20 +780,17 @@ void ItemsSetLimits(int client, int iD, int iLimit)
  **/
 int ItemsGetLimits(int client, int iD)
 {
-    // If array hasn't been created, then create
-    if (gClientData[client].ItemLimit == null)
+    // Gets counter index
+    int iIndex = client * gServerData.ExtraItems.Length + iD;
+    
+    // Validate epoch
+    if (gServerData.ItemLimits.Get(iIndex, LIMITS_DATA_EPOCH) != gClientData[client].ItemEpoch)
     {
-        // Initialize a buy limit array
-        gClientData[client].ItemLimit = new StringMap();
+        return 0;
     }
     
-    // Initialize key char
-    static char sKey[SMALL_LINE_LENGTH];
-    IntToString(iD, sKey, sizeof(sKey));
-    
     // Gets buy limit for the client
-    int iLimit; gClientData[client].ItemLimit.GetValue(sKey, iLimit);
-    return iLimit;
+    return gServerData.ItemLimits.Get(iIndex, LIMITS_DATA_COUNT);
 }
 
 /**
@@ -870,12 +917,10 @@ void ItemsMenu(int client)
 
     // Initialize variables
     static char sBuffer[NORMAL_LINE_LENGTH];
-    static char sName[SMALL_LINE_LENGTH];
     static char sInfo[SMALL_LINE_LENGTH];
-    static char sLevel[SMALL_LINE_LENGTH];
-    static char sLimit[SMALL_LINE_LENGTH];
-    static char sOnline[SMALL_LINE_LENGTH];
-    static char sGroup[SMALL_LINE_LENGTH];
+    
+    // Gets menu template
+    ArrayList hTemplate = MenusGetTemplate(client, MenuTemplate_Items); MenuRow hRow;
     
     // Creates extra items menu handle
     Menu hMenu = new Menu(ItemsMenuSlots);
@@ -893,14 +938,18 @@ void ItemsMenu(int client)
     hMenu.AddItem("-1", sBuffer);
     
     // Initialize forward
-    Action hResult;
+    Action hResult; int iPlaying = fnGetPlaying();
 
-    // i = extraitem index
-    int iSize = gServerData.ExtraItems.Length; int iAmount;
+    // i = row index
+    int iSize = hTemplate.Length; int iAmount;
     for (int i = 0; i < iSize; i++)
     {
+        // Gets row data
+        hTemplate.GetArray(i, hRow, sizeof(hRow));
+        int iD = hRow.ID;
+    
         // Call forward
-        gForwardData._OnClientValidateExtraItem(client, i, hResult);
+        gForwardData._OnClientValidateExtraItem(client, iD, hResult);
         
         // Skip, if item is disabled
         if (hResult == Plugin_Stop)
@@ -909,24 +958,21 @@ void ItemsMenu(int client)
         }
         
         // Skip some item, if class isn't equal
-        if (!ItemsValidateClass(client, i)) 
+        if (!ItemsValidateClass(client, iD)) 
         {
             continue;
         }
         
-        // Gets extra item data
-        ItemsGetName(i, sName, sizeof(sName));
-        ItemsGetGroup(i, sGroup, sizeof(sGroup));
+        // Gets client conditions
+        bool bGroup = (hasLength(hRow.Group) && !IsPlayerInGroup(client, hRow.Group));
+        bool bLimit = (hRow.Limit && hRow.Limit <= ItemsGetLimits(client, iD));
 
         // Format some chars for showing in menu
-        FormatEx(sLevel, sizeof(sLevel), "%t", "level", ItemsGetLevel(i));
-        FormatEx(sLimit, sizeof(sLimit), "%t", "limit", ItemsGetLimit(i));
-        FormatEx(sOnline, sizeof(sOnline), "%t", "online", ItemsGetOnline(i));
-        FormatEx(sBuffer, sizeof(sBuffer), (ItemsGetCost(i)) ? "%t  %s  %t" : "%t  %s", sName, (hasLength(sGroup) && !IsPlayerInGroup(client, sGroup)) ? sGroup : (gClientData[client].Level < ItemsGetLevel(i)) ? sLevel : (ItemsGetLimit(i) && ItemsGetLimit(i) <= ItemsGetLimits(client, i)) ? sLimit : (fnGetPlaying() < ItemsGetOnline(i)) ? sOnline :  "", "price", ItemsGetCost(i), "money");
+        FormatEx(sBuffer, sizeof(sBuffer), (hRow.Cost) ? "%s  %s  %s" : "%s  %s", hRow.Name, bGroup ? hRow.Group : (gClientData[client].Level < hRow.Level) ? hRow.LevelInfo : bLimit ? hRow.LimitInfo : (iPlaying < hRow.Online) ? hRow.OnlineInfo : "", hRow.PriceInfo);
 
         // Show option
-        IntToString(i, sInfo, sizeof(sInfo));
-        hMenu.AddItem(sInfo, sBuffer, MenusGetItemDraw((hResult == Plugin_Handled || (hasLength(sGroup) && !IsPlayerInGroup(client, sGroup)) || gClientData[client].Level < ItemsGetLevel(i) || fnGetPlaying() < ItemsGetOnline(i) || (ItemsGetLimit(i) && ItemsGetLimit(i) <= ItemsGetLimits(client, i)) || (ItemsGetCost(i) && gClientData[client].Money < ItemsGetCost(i))) ? false : true));
+        IntToString(iD, sInfo, sizeof(sInfo));
+        hMenu.AddItem(sInfo, sBuffer, MenusGetItemDraw((hResult == Plugin_Handled || bGroup || gClientData[client].Level < hRow.Level || iPlaying < hRow.Online || bLimit || (hRow.Cost && gClientData[client].Money < hRow.Cost)) ? false : true));
     
         // Increment amount
         iAmount++;
@@ -948,6 +994,31 @@ void ItemsMenu(int client)
     hMenu.Display(client, MENU_TIME_FOREVER); 
 }
 
+/**
+ * @brief Fills the extra items menu template.
+ *  
+ * @param hTemplate         The array of rows.
+ **/ 
+void ItemsMenuTemplate(ArrayList hTemplate)
+{
+    // Initialize variables
+    static char sName[SMALL_LINE_LENGTH];
+    static char sGroup[SMALL_LINE_LENGTH]; MenuRow hRow;
+    
+    // i = extraitem index
+    int iSize = gServerData.ExtraItems.Length;
+    for (int i = 0; i < iSize; i++)
+    {
+        // Gets extra item data
+        ItemsGetName(i, sName, sizeof(sName));
+        ItemsGetGroup(i, sGroup, sizeof(sGroup));
+        
+        // Push row into array
+        MenusSetTemplateRow(hRow, i, sName, sGroup, ItemsGetCost(i), ItemsGetLevel(i), ItemsGetLimit(i), ItemsGetOnline(i));
+        hTemplate.PushArray(hRow, sizeof(hRow));
+    }
+}
+
 /**
  * @brief Called when client selects option in the extra items menu, and handles it.
  *  
@@ -59,6 +59,31 @@ enum
 /**
  * @endsection
  **/
+
+/**
+ * Arrays to store the knockback which is accumulated during the tick.
+ **/
+float gKnockVelocity[MAXPLAYERS+1][3]; bool gKnockPending[MAXPLAYERS+1]; bool gKnockFlush;
+
+/**
+ * @section Struct of the damage readout which is accumulated per attacker.
+ **/
+enum struct DamageReadout
+{
+    int Damage;
+    int Health;
+    int Armor;
+    float Next;
+    bool Pending;
+}
+/**
+ * @endsection
+ **/
+
+/**
+ * Array to store the damage readouts.
+ **/
+DamageReadout gDamageReadout[MAXPLAYERS+1]; bool gDamageFlush; Handle gDamageTimer; float gDamageTimerTime;
  
 /**
  * @brief Hit groups module init function.
@@ -328,7 +353,7 @@ public Action HitGroupsOnTraceAttack(int client, int &attacker, int &inflictor,
     }
 
     // If custom hitgroups enabled, then apply multipliers
-    if (gCvarList.HITGROUP.BoolValue)
+    if (gCvarSnapshot.HitGroup)
     {
         // Validate hitgroup index
         int iHitIndex = HitGroupToIndex(iHitGroup);
@@ -387,7 +412,7 @@ public Action HitGroupsOnTakeDamage(int client, int &attacker, int &inflictor, f
     }
 
     // Validate damage
-    if (!HitGroupsOnCalculateDamage(client, attacker, inflictor, flDamage, iBits, weapon, sClassname))
+    if (!HitGroupsOnCalculateDamage(client, attacker, inflictor, flDamage, iBits, weapon, sClassname, damageForce))
     {
         // Block damage
         return Plugin_Handled;
@@ -421,9 +446,10 @@ public void HitGroupsOnHurtSpawn(int entity)
  * @param iBits             The type of damage inflicted.
  * @param weapon            The weapon index or -1 for unspecified.
  * @param sClassname        The classname string.
+ * @param vForce            The velocity of damage force.
  * @return                  True to allow real damage or false to block real damage.
  **/
-bool HitGroupsOnCalculateDamage(int client, int &attacker, int &inflictor, float &flDamage, int &iBits, int &weapon, char[] sClassname)
+bool HitGroupsOnCalculateDamage(int client, int &attacker, int &inflictor, float &flDamage, int &iBits, int &weapon, char[] sClassname, float vForce[3])
 {
     // Validate victim
     if (!IsPlayerAlive(client))
@@ -433,7 +459,7 @@ bool HitGroupsOnCalculateDamage(int client, int &attacker, int &inflictor, float
     }
     
     // Initialize variables
-    bool bInfectProtect = true; bool bSelfDamage = (client == attacker); bool bHasShield = (WeaponsFindByName(client, "weapon_shield") != -1); bool bHasHeavySuit = ToolsGetHeavySuit(client);
+    bool bInfectProtect = true; bool bSelfDamage = (client == attacker); bool bHasShield = (WeaponsFindByDef(client, ItemDef_Shield) != -1); bool bHasHeavySuit = ToolsGetHeavySuit(client);
     float flDamageRatio = 1.0; float flArmorRatio = 0.5; float flBonusRatio = 0.5; float flKnockRatio = ClassGetKnockBack(gClientData[client].Class); 
 
     // Gets hitgroup index
@@ -449,7 +475,7 @@ bool HitGroupsOnCalculateDamage(int client, int &attacker, int &inflictor, float
     /*_________________________________________________________________________________________________________________________________________*/
     
     // If custom hitgroups enabled, then apply multipliers
-    if (gCvarList.HITGROUP.BoolValue)
+    if (gCvarSnapshot.HitGroup)
     {
         // Validate hitgroup index
         int iHitIndex = HitGroupToIndex(iHitGroup);
@@ -525,10 +551,10 @@ bool HitGroupsOnCalculateDamage(int client, int &attacker, int &inflictor, float
         }
 
         // If level system enabled, then apply multiplier
-        if (gCvarList.LEVEL_SYSTEM.BoolValue)
+        if (gCvarSnapshot.LevelSystem)
         {
             // Add multiplier
-            flDamageRatio *= float(gClientData[attacker].Level) * gCvarList.LEVEL_DAMAGE_RATIO.FloatValue + 1.0;
+            flDamageRatio *= float(gClientData[attacker].Level) * gCvarSnapshot.LevelDamageRatio + 1.0;
         }
 
         /// Validate entity which is inflict damage
@@ -613,13 +639,13 @@ bool HitGroupsOnCalculateDamage(int client, int &attacker, int &inflictor, float
         HitGroupsGiveExp(attacker, iDamage);
         
         // If help messages enabled, then show info
-        if (gCvarList.MESSAGES_DAMAGE.BoolValue) TranslationPrintHintText(attacker, (iArmor > 0) ? "full damage info" : "damage info", (iHealth > 0) ? iHealth : 0, iArmor);
+        if (gCvarSnapshot.MessagesDamage) HitGroupsAddReadout(attacker, iDamage, (iHealth > 0) ? iHealth : 0, iArmor);
 
         // Client was damaged by 'bullet' or 'knife'
         if (iBits & DMG_NEVERGIB)
         {
             // Apply knock
-            HitGroupsApplyKnock(client, attacker, flKnockRatio);
+            HitGroupsApplyKnock(client, attacker, flKnockRatio, vForce);
 
             // Validate zombie
             if (gClientData[attacker].Zombie)
@@ -717,21 +743,8 @@ public int API_TakeDamage(Handle hPlugin, const int iNumParams)
     int iBits = GetNativeCell(5);
     int weapon = GetNativeCell(6);
 
-    // Call fake hook
-    Action hResult = HitGroupsOnTakeDamage(client, attacker, inflictor, flDamage, iBits, weapon, NULL_VECTOR, NULL_VECTOR);
-    
-    // Validate damage 
-    if (hResult == Plugin_Changed)
-    {
-        // If inflictor doesn't exist, then make a self damage
-        if (!IsValidEdict(inflictor)) inflictor = client;
-
-        // If attacker doesn't exist, then make a self damage
-        if (!IsPlayerExist(attacker, false)) attacker = client;
-
-        // Create the damage to kill
-        SDKHooks_TakeDamage(client, inflictor, attacker, flDamage);
-    }
+    // Apply the damage
+    HitGroupsTakeDamage(client, attacker, inflictor, flDamage, iBits, weapon);
 } 
  
 /**
@@ -1300,14 +1313,46 @@ bool HitGroupsValidateInfclictor(char[] sClassname)
     return (!strcmp(sClassname[6], "hurt", false) || !strncmp(sClassname, "infe", 4, false));
 }
 
+/**
+ * @brief Applies fake damage to a player.
+ *
+ * @param client            The client index.
+ * @param attacker          The attacker index.
+ * @param inflictor         The inflictor index.
+ * @param flDamage          The amount of damage.
+ * @param iBits             The type of damage.
+ * @param weapon            The weapon index.
+ **/
+void HitGroupsTakeDamage(int client, int attacker, int inflictor, float flDamage, int iBits, int weapon)
+{
+    // Call fake hook
+    Action hResult = HitGroupsOnTakeDamage(client, attacker, inflictor, flDamage, iBits, weapon, NULL_VECTOR, NULL_VECTOR);
+    
+    // Validate damage 
+    if (hResult == Plugin_Changed)
+    {
+        // If inflictor doesn't exist, then make a self damage
+        if (!IsValidEdict(inflictor)) inflictor = client;
+
+        // If attacker doesn't exist, then make a self damage
+        if (!IsPlayerExist(attacker, false)) attacker = client;
+
+        // Create the damage to kill
+        SDKHooks_TakeDamage(client, inflictor, attacker, flDamage);
+    }
+}
+
 /** 
  * @brief Sets velocity knock for the applied damage.
  *
+ * @note The knock is accumulated per victim and applied once in the next frame.
+ *
  * @param client            The client index.
  * @param attacker          The attacker index.
  * @param flForce           The push force.
+ * @param vForce            (Optional) The velocity of damage force.
  **/
-void HitGroupsApplyKnock(int client, int attacker, float flForce)
+void HitGroupsApplyKnock(int client, int attacker, float flForce, float vForce[3] = NULL_VECTOR)
 {
     // Validate amount
     if (flForce <= 0.0)
@@ -1316,35 +1361,40 @@ void HitGroupsApplyKnock(int client, int attacker, float flForce)
     }
 
     // Apply multiplier if client on air
-    if (GetEntPropEnt(client, Prop_Send, "m_hGroundEntity") == -1) flForce *= gCvarList.HITGROUP_KNOCKBACK_AIR.FloatValue;
+    if (GetEntPropEnt(client, Prop_Send, "m_hGroundEntity") == -1) flForce *= gCvarSnapshot.KnockbackAir;
     
     // If knockback system is enabled, then apply
-    if (gCvarList.HITGROUP_KNOCKBACK.BoolValue) 
+    if (gCvarSnapshot.Knockback) 
     {
         // Initialize vectors
-        static float vPosition[3]; static float vAngle[3]; static float vVelocity[3]; static float vEndPosition[3];
-
-        // Gets attacker position
-        GetClientEyeAngles(attacker, vAngle);
-        GetClientEyePosition(attacker, vPosition);
-
-        // Create the infinite trace
-        TR_TraceRayFilter(vPosition, vAngle, MASK_ALL, RayType_Infinite, HitGroupsFilter, attacker);
+        static float vVelocity[3];
 
-        // Gets hit point
-        TR_GetEndPosition(vEndPosition);
-
-        // Gets vector from the given starting and ending points
-        MakeVectorFromPoints(vPosition, vEndPosition, vVelocity);
-
-        // Normalize the vector (equal magnitude at varying distances)
-        NormalizeVector(vVelocity, vVelocity);
+        // Validate damage force
+        if (!IsNullVector(vForce) && GetVectorLength(vForce) > 0.0)
+        {
+            // Gets direction of the damage
+            NormalizeVector(vForce, vVelocity);
+        }
+        else
+        {
+            // Gets direction of the attacker view
+            HitGroupsGetDirection(attacker, vVelocity);
+        }
 
         // Apply the magnitude by scaling the vector
         ScaleVector(vVelocity, flForce);
 
-        // Adds the given vector to the client current velocity
-        ToolsSetVelocity(client, vVelocity);
+        // Adds the given vector to the accumulated velocity
+        AddVectors(gKnockVelocity[client], vVelocity, gKnockVelocity[client]);
+        gKnockPending[client] = true;
+        
+        // Validate flush
+        if (!gKnockFlush)
+        {
+            // Apply knock on the next frame
+            RequestFrame(HitGroupsOnKnockFlush);
+            gKnockFlush = true;
+        }
     }
     else
     {
@@ -1357,6 +1407,176 @@ void HitGroupsApplyKnock(int client, int attacker, float flForce)
     }
 }
 
+/**
+ * @brief Gets the view direction of the attacker.
+ *
+ * @note The direction is cached per attacker per tick.
+ *
+ * @param attacker          The attacker index.
+ * @param vDirection        The direction output.
+ **/
+void HitGroupsGetDirection(int attacker, float vDirection[3])
+{
+    // Initialize cache
+    static int iTick[MAXPLAYERS+1]; static float vCache[MAXPLAYERS+1][3];
+
+    // Validate tick
+    int iCurrentTick = GetGameTickCount();
+    if (iTick[attacker] != iCurrentTick)
+    {
+        // Gets attacker angle
+        static float vAngle[3];
+        GetClientEyeAngles(attacker, vAngle);
+
+        // Gets forward vector of the view
+        GetAngleVectors(vAngle, vCache[attacker], NULL_VECTOR, NULL_VECTOR);
+        iTick[attacker] = iCurrentTick;
+    }
+
+    // Return direction on success
+    vDirection = vCache[attacker];
+}
+
+/**
+ * @brief Applies the accumulated knock on the next frame.
+ **/
+public void HitGroupsOnKnockFlush(/*void*/)
+{
+    // Resets flush
+    gKnockFlush = false;
+
+    // i = client index
+    for (int i = 1; i <= MaxClients; i++)
+    {
+        // Validate knock
+        if (!gKnockPending[i])
+        {
+            continue;
+        }
+
+        // Validate client
+        if (IsPlayerExist(i))
+        {
+            // Adds the given vector to the client current velocity
+            ToolsSetVelocity(i, gKnockVelocity[i]);
+        }
+
+        // Resets knock
+        gKnockVelocity[i] = NULL_VECTOR;
+        gKnockPending[i] = false;
+    }
+}
+
+/**
+ * @brief Adds the applied damage to the attacker readout.
+ *
+ * @note The readout is shown once per tick and not more often than the message interval.
+ *
+ * @param attacker          The attacker index.
+ * @param iDamage           The damage amount.
+ * @param iHealth           The victim health.
+ * @param iArmor            The victim armor.
+ **/
+void HitGroupsAddReadout(int attacker, int iDamage, int iHealth, int iArmor)
+{
+    // Add damage and store the last victim state
+    gDamageReadout[attacker].Damage += iDamage;
+    gDamageReadout[attacker].Health = iHealth;
+    gDamageReadout[attacker].Armor = iArmor;
+    gDamageReadout[attacker].Pending = true;
+
+    // Validate flush
+    if (!gDamageFlush)
+    {
+        // Show readouts on the next frame
+        RequestFrame(HitGroupsOnReadoutFlush);
+        gDamageFlush = true;
+    }
+}
+
+/**
+ * @brief Shows the accumulated damage readouts.
+ **/
+public void HitGroupsOnReadoutFlush(/*void*/)
+{
+    // Resets flush
+    gDamageFlush = false;
+
+    // Initialize variables
+    float flCurrentTime = GetGameTime(); float flNext = -1.0;
+
+    // i = client index
+    for (int i = 1; i <= MaxClients; i++)
+    {
+        // Validate readout
+        if (!gDamageReadout[i].Pending)
+        {
+            continue;
+        }
+
+        // Validate client
+        if (!IsPlayerExist(i, false))
+        {
+            // Resets readout
+            gDamageReadout[i].Damage = 0;
+            gDamageReadout[i].Pending = false;
+            continue;
+        }
+
+        // Validate interval (also if game time was reset)
+        if (flCurrentTime < gDamageReadout[i].Next && gDamageReadout[i].Next - flCurrentTime <= gCvarSnapshot.MessagesDamageInterval)
+        {
+            // Gets the earliest pending readout
+            if (flNext < 0.0 || gDamageReadout[i].Next < flNext) flNext = gDamageReadout[i].Next;
+            continue;
+        }
+
+        // Show info
+        if (gDamageReadout[i].Armor > 0) TranslationPrintHintText(i, "full damage info", gDamageReadout[i].Health, gDamageReadout[i].Armor, gDamageReadout[i].Damage);
+        else TranslationPrintHintText(i, "damage info", gDamageReadout[i].Health, gDamageReadout[i].Damage);
+
+        // Resets readout
+        gDamageReadout[i].Damage = 0;
+        gDamageReadout[i].Pending = false;
+        gDamageReadout[i].Next = flCurrentTime + gCvarSnapshot.MessagesDamageInterval;
+    }
+
+    // Validate pending
+    if (flNext >= 0.0)
+    {
+        // Validate timer, the earlier one is kept
+        if (gDamageTimer != null && gDamageTimerTime <= flNext)
+        {
+            return;
+        }
+        
+        // Show readouts once the interval is over
+        delete gDamageTimer;
+        gDamageTimer = CreateTimer(flNext - flCurrentTime, HitGroupsOnReadoutTimer);
+        gDamageTimerTime = flNext;
+    }
+}
+
+/**
+ * @brief Timer callback, shows the readouts delayed by the message interval.
+ *
+ * @param hTimer            The timer handle.
+ **/
+public Action HitGroupsOnReadoutTimer(Handle hTimer)
+{
+    // Clear timer
+    gDamageTimer = null;
+    
+    // Validate flush, it will show them anyway
+    if (!gDamageFlush)
+    {
+        HitGroupsOnReadoutFlush();
+    }
+    
+    // Destroy timer
+    return Plugin_Stop;
+}
+
 /**
  * @brief Reward money for the applied damage.
  *
@@ -1390,7 +1610,7 @@ void HitGroupsGiveMoney(int client, int iDamage)
     }
     
     // Give money for the attacker
-    AccountSetClientCash(client, gClientData[client].Money + iBonus);
+    LedgerAddMoney(client, iBonus);
     
     // Resets damage filter
     iAppliedDamage[client] -= iBonus * iLimit;
@@ -1405,7 +1625,7 @@ void HitGroupsGiveMoney(int client, int iDamage)
 void HitGroupsGiveExp(int client, int iDamage)
 {
     // If level system disabled, then stop
-    if (!gCvarList.LEVEL_SYSTEM.BoolValue)
+    if (!gCvarSnapshot.LevelSystem)
     {
         return;
     }
@@ -1435,21 +1655,8 @@ void HitGroupsGiveExp(int client, int iDamage)
     }
     
     // Give experience for the attacker
-    LevelSystemOnSetExp(client, gClientData[client].Exp + iBonus);
+    LedgerAddExp(client, iBonus);
     
     // Resets damage filter
     iAppliedDamage[client] -= iBonus * iLimit;
 }
-
-/**
- * @brief Trace filter.
- *  
- * @param entity            The entity index.
- * @param contentsMask      The contents mask.
- * @param client            The client index.
- * @return                  True or false.
- **/
-public bool HitGroupsFilter(int entity, int contentsMask, int client)
-{
-    return (entity != client);
-}
\ No newline at end of file
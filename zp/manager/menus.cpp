@@ -41,6 +41,41 @@ enum
  * @endsection
  **/
  
+/**
+ * @section Menu template types.
+ **/
+enum MenuTemplate
+{
+    MenuTemplate_Items,
+    MenuTemplate_Weapons,
+    MenuTemplate_Classes,
+    MenuTemplate_Costumes
+};
+/**
+ * @endsection
+ **/
+ 
+/**
+ * @section Struct of operation types for menu template rows.
+ **/
+enum struct MenuRow
+{
+    int ID;
+    int Cost;
+    int Level;
+    int Limit;
+    int Online;
+    char Group[SMALL_LINE_LENGTH];
+    char Name[NORMAL_LINE_LENGTH];
+    char LevelInfo[SMALL_LINE_LENGTH];
+    char LimitInfo[SMALL_LINE_LENGTH];
+    char OnlineInfo[SMALL_LINE_LENGTH];
+    char PriceInfo[SMALL_LINE_LENGTH];
+}
+/**
+ * @endsection
+ **/
+ 
 /**
  * @brief Prepare all menu data.
  **/
@@ -816,6 +851,125 @@ int MenusGetItemDraw(bool menuCondition)
     return menuCondition ? ITEMDRAW_DEFAULT : ITEMDRAW_DISABLED;
 }
 
+/*
+ * Menu template API.
+ */
+
+/**
+ * @brief Gets the cached rows of a menu in the client language.
+ *
+ * @note Rows hold the translated and filtered static data only, 
+ *       the per-client conditions are checked on display.
+ *
+ * @param client            The client index.
+ * @param nTemplate         The template type.
+ * @param sKey              (Optional) The static filter. (slot, type)
+ * @return                  The array of rows.
+ **/
+ArrayList MenusGetTemplate(int client, MenuTemplate nTemplate, char[] sKey = "")
+{
+    // If map hasn't been created, then create
+    if (gServerData.Templates == null)
+    {
+        // Initialize a template map
+        gServerData.Templates = new StringMap();
+    }
+    
+    // Initialize key char
+    static char sCache[NORMAL_LINE_LENGTH];
+    FormatEx(sCache, sizeof(sCache), "%d:%d:%s", GetClientLanguage(client), nTemplate, sKey);
+    
+    // Validate template
+    ArrayList hTemplate;
+    if (gServerData.Templates.GetValue(sCache, hTemplate))
+    {
+        return hTemplate;
+    }
+    
+    // Initialize a template array
+    hTemplate = new ArrayList(sizeof(MenuRow));
+
+    // Sets language to target
+    SetGlobalTransTarget(client);
+    
+    // Switch template
+    switch (nTemplate)
+    {
+        case MenuTemplate_Items    : ItemsMenuTemplate(hTemplate);
+        case MenuTemplate_Weapons  : ZMarketMenuTemplate(hTemplate, sKey);
+        case MenuTemplate_Classes  : ClassMenuTemplate(hTemplate, sKey);
+        case MenuTemplate_Costumes : CostumesMenuTemplate(hTemplate);
+    }
+    
+    // Store template
+    gServerData.Templates.SetValue(sCache, hTemplate);
+    return hTemplate;
+}
+
+/**
+ * @brief Formats the static data of a menu row.
+ *
+ * @note Translations are done to the current global target.
+ *
+ * @param hRow              The row data.
+ * @param iD                The config index.
+ * @param sName             The name phrase.
+ * @param sGroup            The group name.
+ * @param iCost             The cost amount.
+ * @param iLevel            The level amount.
+ * @param iLimit            The limit amount.
+ * @param iOnline           The online amount.
+ **/
+void MenusSetTemplateRow(MenuRow hRow, int iD, char[] sName, char[] sGroup, int iCost = 0, int iLevel = 0, int iLimit = 0, int iOnline = 0)
+{
+    // Sets row data
+    hRow.ID = iD;
+    hRow.Cost = iCost;
+    hRow.Level = iLevel;
+    hRow.Limit = iLimit;
+    hRow.Online = iOnline;
+    strcopy(hRow.Group, sizeof(hRow.Group), sGroup);
+    
+    // Format some chars for showing in menu
+    FormatEx(hRow.Name, sizeof(hRow.Name), "%t", sName);
+    FormatEx(hRow.LevelInfo, sizeof(hRow.LevelInfo), "%t", "level", iLevel);
+    FormatEx(hRow.LimitInfo, sizeof(hRow.LimitInfo), "%t", "limit", iLimit);
+    FormatEx(hRow.OnlineInfo, sizeof(hRow.OnlineInfo), "%t", "online", iOnline);
+    FormatEx(hRow.PriceInfo, sizeof(hRow.PriceInfo), "%t", "price", iCost, "money");
+}
+
+/**
+ * @brief Removes all menu templates.
+ **/
+void MenusClearTemplates(/*void*/)
+{
+    // Validate map
+    if (gServerData.Templates == null)
+    {
+        return;
+    }
+    
+    // Initialize variables
+    static char sKey[NORMAL_LINE_LENGTH]; ArrayList hTemplate;
+    StringMapSnapshot hSnapshot = gServerData.Templates.Snapshot();
+    
+    // i = template index
+    int iSize = hSnapshot.Length;
+    for (int i = 0; i < iSize; i++)
+    {
+        // Gets template array
+        hSnapshot.GetKey(i, sKey, sizeof(sKey));
+        gServerData.Templates.GetValue(sKey, hTemplate);
+        
+        // Delete array
+        delete hTemplate;
+    }
+    
+    // Clear out the map of all data
+    gServerData.Templates.Clear();
+    delete hSnapshot;
+}
+
 /*
  * Menu main API.
  */
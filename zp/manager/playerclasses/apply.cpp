@@ -168,9 +168,9 @@ bool ApplyOnClientUpdate(int client, int attacker = 0, char[] sType = "zombie")
     }
     
     // Sets health, speed and gravity and armor
-    ToolsSetHealth(client, ClassGetHealth(gClientData[client].Class) + (gCvarList.LEVEL_SYSTEM.BoolValue ? RoundToNearest(gCvarList.LEVEL_HEALTH_RATIO.FloatValue * float(gClientData[client].Level)) : 0), true);
-    ToolsSetLMV(client, ClassGetSpeed(gClientData[client].Class) + (gCvarList.LEVEL_SYSTEM.BoolValue ? (gCvarList.LEVEL_SPEED_RATIO.FloatValue * float(gClientData[client].Level)) : 0.0));
-    ToolsSetGravity(client, ClassGetGravity(gClientData[client].Class) + (gCvarList.LEVEL_SYSTEM.BoolValue ? (gCvarList.LEVEL_GRAVITY_RATIO.FloatValue * float(gClientData[client].Level)) : 0.0));
+    ToolsSetHealth(client, ClassGetHealth(gClientData[client].Class) + (gCvarSnapshot.LevelSystem ? RoundToNearest(gCvarSnapshot.LevelHealthRatio * float(gClientData[client].Level)) : 0), true);
+    ToolsSetLMV(client, ClassGetSpeed(gClientData[client].Class) + (gCvarSnapshot.LevelSystem ? (gCvarSnapshot.LevelSpeedRatio * float(gClientData[client].Level)) : 0.0));
+    ToolsSetGravity(client, ClassGetGravity(gClientData[client].Class) + (gCvarSnapshot.LevelSystem ? (gCvarSnapshot.LevelGravityRatio * float(gClientData[client].Level)) : 0.0));
     ToolsSetArmor(client, (ToolsGetArmor(client) < ClassGetArmor(gClientData[client].Class)) ? ClassGetArmor(gClientData[client].Class) : ToolsGetArmor(client));
     ToolsSetHud(client, ClassIsCross(gClientData[client].Class));
     ToolsSetSpot(client, ClassIsSpot(gClientData[client].Class));
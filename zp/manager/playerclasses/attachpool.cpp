@@ -0,0 +1,291 @@
+/**
+ * ============================================================================
+ *
+ *  Zombie Plague
+ *
+ *  File:          attachpool.cpp
+ *  Type:          Module
+ *  Description:   Pool of the attachment entities per client.
+ *
+ *  Copyright (C) 2015-2020 Nikita Ushakov (Ireland, Dublin)
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * ============================================================================
+ **/
+
+/**
+ * @section Properties of the attachment pool.
+ **/
+#define ATTACHPOOL_SLOT_COSTUME  12                              /** Slot of the costume, after the weapon back attachments. */
+#define ATTACHPOOL_SLOT_MAX      13                              /** Amount of the slots per client. */
+#define ATTACHPOOL_ENTITY_MAX    2048                            /** Max amount of the edicts. */
+#define ATTACHPOOL_EFFECTS       (EF_BONEMERGE | EF_BONEMERGE_FASTCULL)
+/**
+ * @endsection
+ **/
+
+/**
+ * @section Attachment entity states.
+ **/
+enum
+{
+    ATTACHPOOL_STATE_IDLE   = 0,        /** Entity is hidden and waits for reuse. */
+    ATTACHPOOL_STATE_ACTIVE = (1<<0),   /** Entity is shown on the client. */
+    ATTACHPOOL_STATE_HIDE   = (1<<1)    /** Entity is not transmitted to the owner. */
+};
+/**
+ * @endsection
+ **/
+
+/**
+ * Arrays to store the pooled entities.
+ **/
+int gAttachPool[MAXPLAYERS+1][ATTACHPOOL_SLOT_MAX]; int gAttachPoolState[ATTACHPOOL_ENTITY_MAX];
+int gAttachPoolCreated; int gAttachPoolReused; int gAttachPoolReleased; int gAttachPoolDestroyed;
+
+/**
+ * @brief Attachment pool module init function.
+ **/
+void AttachPoolOnInit(/*void*/)
+{
+    // i = client index
+    for (int i = 1; i <= MaxClients; i++)
+    {
+        // x = slot index
+        for (int x = 0; x < ATTACHPOOL_SLOT_MAX; x++)
+        {
+            // Clear the client cache
+            gAttachPool[i][x] = -1;
+        }
+    }
+}
+
+/**
+ * @brief Attachment pool module unload function.
+ **/
+void AttachPoolOnUnload(/*void*/)
+{
+    // i = client index
+    for (int i = 1; i <= MaxClients; i++)
+    {
+        // Destroy all entities
+        AttachPoolOnClientDisconnect(i);
+    }
+}
+
+/**
+ * @brief Creates commands for attachment pool module.
+ **/
+void AttachPoolOnCommandInit(/*void*/)
+{
+    // Hook commands
+    RegAdminCmd("zp_attachment_stats", AttachPoolOnCommandCatched, ADMFLAG_CONFIG, "Prints the attachment pool statistics.");
+}
+
+/**
+ * @brief Called when a client is disconnecting from the server.
+ *
+ * @param client            The client index.
+ **/
+void AttachPoolOnClientDisconnect(int client)
+{
+    // i = slot index
+    for (int i = 0; i < ATTACHPOOL_SLOT_MAX; i++)
+    {
+        // Gets pooled entity from the client reference
+        int entity = EntRefToEntIndex(gAttachPool[client][i]);
+
+        // Validate entity
+        if (entity != -1)
+        {
+            AcceptEntityInput(entity, "Kill"); /// Destroy
+            gAttachPoolDestroyed++;
+        }
+
+        // Clear the client cache
+        gAttachPool[client][i] = -1;
+    }
+}
+
+/**
+ * Console command callback (zp_attachment_stats)
+ * @brief Prints the attachment pool statistics.
+ *
+ * @param client            The client index.
+ * @param iArguments        The number of arguments that were in the argument string.
+ **/
+public Action AttachPoolOnCommandCatched(int client, int iArguments)
+{
+    // Initialize variables
+    static char sBuffer[HUGE_LINE_LENGTH]; sBuffer[0] = NULL_STRING[0];
+    static char sLine[BIG_LINE_LENGTH]; int iPooled; int iActive;
+
+    // i = client index
+    for (int i = 1; i <= MaxClients; i++)
+    {
+        // x = slot index
+        for (int x = 0; x < ATTACHPOOL_SLOT_MAX; x++)
+        {
+            // Validate entity
+            int entity = EntRefToEntIndex(gAttachPool[i][x]);
+            if (entity != -1)
+            {
+                // Update the counters
+                iPooled++;
+                if (gAttachPoolState[entity] & ATTACHPOOL_STATE_ACTIVE) iActive++;
+            }
+        }
+    }
+
+    // Format strings
+    FormatEx(sLine, sizeof(sLine), "%24s: %d\n", "Pooled", iPooled);
+    StrCat(sBuffer, sizeof(sBuffer), sLine);
+    FormatEx(sLine, sizeof(sLine), "%24s: %d\n", "Active", iActive);
+    StrCat(sBuffer, sizeof(sBuffer), sLine);
+    FormatEx(sLine, sizeof(sLine), "%24s: %d\n", "Idle", iPooled - iActive);
+    StrCat(sBuffer, sizeof(sBuffer), sLine);
+    FormatEx(sLine, sizeof(sLine), "%24s: %d\n", "Created", gAttachPoolCreated);
+    StrCat(sBuffer, sizeof(sBuffer), sLine);
+    FormatEx(sLine, sizeof(sLine), "%24s: %d\n", "Reused", gAttachPoolReused);
+    StrCat(sBuffer, sizeof(sBuffer), sLine);
+    FormatEx(sLine, sizeof(sLine), "%24s: %d\n", "Released", gAttachPoolReleased);
+    StrCat(sBuffer, sizeof(sBuffer), sLine);
+    FormatEx(sLine, sizeof(sLine), "%24s: %d\n", "Destroyed", gAttachPoolDestroyed);
+    StrCat(sBuffer, sizeof(sBuffer), sLine);
+
+    /// Every reuse was a create before, and every release was a kill
+    FormatEx(sLine, sizeof(sLine), "%24s: %d\n", "Saved creates", gAttachPoolReused);
+    StrCat(sBuffer, sizeof(sBuffer), sLine);
+    FormatEx(sLine, sizeof(sLine), "%24s: %d\n", "Saved kills", gAttachPoolReleased - gAttachPoolDestroyed);
+    StrCat(sBuffer, sizeof(sBuffer), sLine);
+
+    // Send information into the console
+    ReplyToCommand(client, sBuffer);
+    return Plugin_Handled;
+}
+
+/*
+ * Stocks attachment pool API.
+ */
+
+/**
+ * @brief Gets the pooled entity for the slot and shows it on the client.
+ *
+ * @note The entity is created only once per slot, then model is re-targeted.
+ *       Caller sets textures, attachment and merging after this.
+ *
+ * @param client            The client index.
+ * @param iSlot             The slot index.
+ * @param sName             The name of the entity.
+ * @param sModel            The model path.
+ * @param bHide             True to not transmit entity to the owner.
+ * @return                  The entity index, or -1 on failure.
+ **/
+int AttachPoolAcquire(int client, int iSlot, char[] sName, char[] sModel, bool bHide)
+{
+    // Gets pooled entity from the client reference
+    int entity = EntRefToEntIndex(gAttachPool[client][iSlot]);
+
+    // Validate entity
+    if (entity == -1)
+    {
+        // Creates an attach addon entity
+        entity = UTIL_CreateDynamic(sName, NULL_VECTOR, NULL_VECTOR, sModel);
+
+        // If entity isn't valid, then stop
+        if (entity == -1 || entity >= ATTACHPOOL_ENTITY_MAX)
+        {
+            return -1;
+        }
+
+        // Hook entity callbacks
+        SDKHook(entity, SDKHook_SetTransmit, AttachPoolOnEntityTransmit);
+
+        // Store the client cache
+        gAttachPool[client][iSlot] = EntIndexToEntRef(entity);
+        gAttachPoolCreated++;
+    }
+    else
+    {
+        // Re-target the model
+        SetEntityModel(entity, sModel);
+
+        // Resets previous parent and merging
+        AcceptEntityInput(entity, "ClearParent");
+        ToolsSetEffect(entity, ToolsGetEffect(entity) & ~ATTACHPOOL_EFFECTS);
+        gAttachPoolReused++;
+    }
+
+    // Sets parent to the entity
+    SetVariantString("!activator");
+    AcceptEntityInput(entity, "SetParent", client, entity);
+    ToolsSetOwner(entity, client);
+
+    // Show the entity
+    ToolsSetEffect(entity, ToolsGetEffect(entity) & ~EF_NODRAW);
+    gAttachPoolState[entity] = ATTACHPOOL_STATE_ACTIVE | (bHide ? ATTACHPOOL_STATE_HIDE : ATTACHPOOL_STATE_IDLE);
+    return entity;
+}
+
+/**
+ * @brief Hides the pooled entity of the slot for the next reuse.
+ *
+ * @param client            The client index.
+ * @param iSlot             The slot index.
+ **/
+void AttachPoolRelease(int client, int iSlot)
+{
+    // Gets pooled entity from the client reference
+    int entity = EntRefToEntIndex(gAttachPool[client][iSlot]);
+
+    // Validate active entity
+    if (entity != -1 && gAttachPoolState[entity] & ATTACHPOOL_STATE_ACTIVE)
+    {
+        // Hide the entity
+        ToolsSetEffect(entity, ToolsGetEffect(entity) | EF_NODRAW);
+        gAttachPoolState[entity] = ATTACHPOOL_STATE_IDLE;
+        gAttachPoolReleased++;
+    }
+}
+
+/**
+ * Hook: SetTransmit
+ * @brief Called right before the entity transmitting to other entities.
+ *
+ * @param entity            The entity index.
+ * @param client            The client index.
+ **/
+public Action AttachPoolOnEntityTransmit(int entity, int client)
+{
+    // Gets state of the entity
+    int iState = gAttachPoolState[entity];
+
+    // Validate idle entity
+    if (!(iState & ATTACHPOOL_STATE_ACTIVE))
+    {
+        // Block transmitting
+        return Plugin_Handled;
+    }
+
+    // Validate hidden entity
+    if (iState & ATTACHPOOL_STATE_HIDE)
+    {
+        // Block transmitting to the owner
+        return ToolsOnEntityTransmit(entity, client);
+    }
+
+    // Allow transmitting
+    return Plugin_Continue;
+}
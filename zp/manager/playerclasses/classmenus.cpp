@@ -232,10 +232,10 @@ void ClassMenu(int client, char[] sTitle, char[] sType, int iClass, bool bInstan
 
     // Initialize variables
     static char sBuffer[NORMAL_LINE_LENGTH];
-    static char sName[SMALL_LINE_LENGTH];
     static char sInfo[SMALL_LINE_LENGTH];
-    static char sLevel[SMALL_LINE_LENGTH];
-    static char sGroup[SMALL_LINE_LENGTH];
+    
+    // Gets menu template
+    ArrayList hTemplate = MenusGetTemplate(client, MenuTemplate_Classes, sType); MenuRow hRow;
 
     // Creates menu handle
     Menu hMenu = new Menu((!strcmp(sType, "zombie", false)) ? (bInstant ? ClassZombieMenuSlots2 : ClassZombieMenuSlots1) : (bInstant ? ClassHumanMenuSlots2 : ClassHumanMenuSlots1));
@@ -249,12 +249,16 @@ void ClassMenu(int client, char[] sTitle, char[] sType, int iClass, bool bInstan
     // Initialize forward
     Action hResult;
     
-    // i = class index
-    int iSize = gServerData.Classes.Length; int iAmount;
+    // i = row index
+    int iSize = hTemplate.Length; int iAmount;
     for (int i = 0; i < iSize; i++)
     {
+        // Gets row data
+        hTemplate.GetArray(i, hRow, sizeof(hRow));
+        int iD = hRow.ID;
+        
         // Call forward
-        gForwardData._OnClientValidateClass(client, i, hResult);
+        gForwardData._OnClientValidateClass(client, iD, hResult);
         
         // Skip, if class is disabled
         if (hResult == Plugin_Stop)
@@ -262,26 +266,15 @@ void ClassMenu(int client, char[] sTitle, char[] sType, int iClass, bool bInstan
             continue;
         }
         
-        // Gets class type
-        ClassGetType(i, sName, sizeof(sName));
-        
-        // Skip some classes, if types isn't equal
-        if (strcmp(sName, sType, false))
-        {
-            continue;
-        }
-        
-        // Gets general class data
-        ClassGetName(i, sName, sizeof(sName));
-        ClassGetGroup(i, sGroup, sizeof(sGroup));
+        // Gets client conditions
+        bool bGroup = (hasLength(hRow.Group) && !IsPlayerInGroup(client, hRow.Group));
         
         // Format some chars for showing in menu
-        FormatEx(sLevel, sizeof(sLevel), "%t", "level", ClassGetLevel(i));
-        FormatEx(sBuffer, sizeof(sBuffer), "%t  %s", sName, (hasLength(sGroup) && !IsPlayerInGroup(client, sGroup)) ? sGroup : (gClientData[client].Level < ClassGetLevel(i)) ? sLevel : "");
+        FormatEx(sBuffer, sizeof(sBuffer), "%s  %s", hRow.Name, bGroup ? hRow.Group : (gClientData[client].Level < hRow.Level) ? hRow.LevelInfo : "");
 
         // Show option
-        IntToString(i, sInfo, sizeof(sInfo));
-        hMenu.AddItem(sInfo, sBuffer, MenusGetItemDraw((hResult == Plugin_Handled || (hasLength(sGroup) && !IsPlayerInGroup(client, sGroup)) || gClientData[client].Level < ClassGetLevel(i) || iClass == i) ? false : true));
+        IntToString(iD, sInfo, sizeof(sInfo));
+        hMenu.AddItem(sInfo, sBuffer, MenusGetItemDraw((hResult == Plugin_Handled || bGroup || gClientData[client].Level < hRow.Level || iClass == iD) ? false : true));
     
         // Increment amount
         iAmount++;
@@ -303,6 +296,41 @@ void ClassMenu(int client, char[] sTitle, char[] sType, int iClass, bool bInstan
     hMenu.Display(client, bInstant ? MENU_TIME_INSTANT : MENU_TIME_FOREVER); 
 }
 
+/**
+ * @brief Fills the class menu template.
+ *  
+ * @param hTemplate         The array of rows.
+ * @param sType             The class type.
+ **/ 
+void ClassMenuTemplate(ArrayList hTemplate, char[] sType)
+{
+    // Initialize variables
+    static char sName[SMALL_LINE_LENGTH];
+    static char sGroup[SMALL_LINE_LENGTH]; MenuRow hRow;
+    
+    // i = class index
+    int iSize = gServerData.Classes.Length;
+    for (int i = 0; i < iSize; i++)
+    {
+        // Gets class type
+        ClassGetType(i, sName, sizeof(sName));
+        
+        // Skip some classes, if types isn't equal
+        if (strcmp(sName, sType, false))
+        {
+            continue;
+        }
+        
+        // Gets general class data
+        ClassGetName(i, sName, sizeof(sName));
+        ClassGetGroup(i, sGroup, sizeof(sGroup));
+        
+        // Push row into array
+        MenusSetTemplateRow(hRow, i, sName, sGroup, _, ClassGetLevel(i));
+        hTemplate.PushArray(hRow, sizeof(hRow));
+    }
+}
+
 /**
  * @brief Called when client selects option in the zombie class menu, and handles it.
  *  
@@ -311,7 +311,11 @@ bool DeathOnClientRespawn(int client, int attacker = 0,  bool bTimer = true)
     else
     {
         // Respawn a player
-        ToolsForceToRespawn(client);
+        if (ToolsForceToRespawn(client))
+        {
+            // Move player to the least occupied spawn of the team
+            SpawnTeleportToRespawn(client, gClientData[client].Respawn);
+        }
     }
     
     // Return on success
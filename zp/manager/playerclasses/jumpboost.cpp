@@ -130,7 +130,7 @@ public void JumpBoostOnClientEntChanged(int client)
     if (GetEntityMoveType(client) != MOVETYPE_LADDER)
     {
         // Resets gravity
-        ToolsSetGravity(client, ClassGetGravity(gClientData[client].Class) + (gCvarList.LEVEL_SYSTEM.BoolValue ? (gCvarList.LEVEL_GRAVITY_RATIO.FloatValue * float(gClientData[client].Level)) : 0.0));
+        ToolsSetGravity(client, ClassGetGravity(gClientData[client].Class) + (gCvarSnapshot.LevelSystem ? (gCvarSnapshot.LevelGravityRatio * float(gClientData[client].Level)) : 0.0));
     }
 }
 
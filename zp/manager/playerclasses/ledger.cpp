@@ -0,0 +1,208 @@
+/**
+ * ============================================================================
+ *
+ *  Zombie Plague
+ *
+ *  File:          ledger.cpp
+ *  Type:          Module
+ *  Description:   Batches money and experience awards. (economy ledger)
+ *
+ *  Copyright (C) 2015-2020 Nikita Ushakov (Ireland, Dublin)
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * ============================================================================
+ **/
+
+/**
+ * @section Struct of operation types for ledger arrays.
+ **/
+enum struct LedgerData
+{
+    int Money;
+    int Exp;
+    bool Pending;
+}
+/**
+ * @endsection
+ **/
+
+/**
+ * Array to store the pending awards.
+ **/
+LedgerData gLedgerData[MAXPLAYERS+1]; bool gLedgerFlush; int gLedgerAwards; int gLedgerCommits;
+
+/**
+ * @brief Creates commands for ledger module.
+ **/
+void LedgerOnCommandInit(/*void*/)
+{
+    // Hook commands
+    RegAdminCmd("zp_ledger_stats", LedgerOnCommandCatched, ADMFLAG_CONFIG, "Prints the economy ledger statistics.");
+}
+
+/**
+ * @brief Called when a client is disconnecting from the server.
+ *
+ * @param client            The client index.
+ **/
+void LedgerOnClientDisconnect(int client)
+{
+    // Validate awards
+    if (gLedgerData[client].Pending)
+    {
+        // Commit awards before the client data is saved
+        LedgerOnCommit(client);
+    }
+}
+
+/**
+ * Console command callback (zp_ledger_stats)
+ * @brief Prints the economy ledger statistics.
+ *
+ * @param client            The client index.
+ * @param iArguments        The number of arguments that were in the argument string.
+ **/
+public Action LedgerOnCommandCatched(int client, int iArguments)
+{
+    // Initialize variables
+    static char sBuffer[HUGE_LINE_LENGTH]; sBuffer[0] = NULL_STRING[0];
+    static char sLine[BIG_LINE_LENGTH];
+
+    // Format strings
+    FormatEx(sLine, sizeof(sLine), "%24s: %d\n", "Awards", gLedgerAwards);
+    StrCat(sBuffer, sizeof(sBuffer), sLine);
+    FormatEx(sLine, sizeof(sLine), "%24s: %d\n", "Commits", gLedgerCommits);
+    StrCat(sBuffer, sizeof(sBuffer), sLine);
+
+    // Send information into the console
+    ReplyToCommand(client, sBuffer);
+    return Plugin_Handled;
+}
+
+/*
+ * Stocks ledger API.
+ */
+
+/**
+ * @brief Adds the money award to the ledger.
+ *
+ * @param client            The client index.
+ * @param iMoney            The money amount.
+ **/
+void LedgerAddMoney(int client, int iMoney)
+{
+    // Add the award
+    gLedgerData[client].Money += iMoney;
+
+    // Forward event to modules
+    LedgerOnAward(client);
+}
+
+/**
+ * @brief Adds the experience award to the ledger.
+ *
+ * @param client            The client index.
+ * @param iExp              The experience amount.
+ **/
+void LedgerAddExp(int client, int iExp)
+{
+    // Add the award
+    gLedgerData[client].Exp += iExp;
+
+    // Forward event to modules
+    LedgerOnAward(client);
+}
+
+/**
+ * @brief Marks the client awards as pending.
+ *
+ * @param client            The client index.
+ **/
+void LedgerOnAward(int client)
+{
+    // Update the counter
+    gLedgerData[client].Pending = true;
+    gLedgerAwards++;
+
+    // Validate flush
+    if (!gLedgerFlush)
+    {
+        // Commit awards on the next frame
+        RequestFrame(LedgerOnFlush);
+        gLedgerFlush = true;
+    }
+}
+
+/**
+ * @brief Commits all pending awards on the next frame.
+ **/
+public void LedgerOnFlush(/*void*/)
+{
+    // Resets flush
+    gLedgerFlush = false;
+
+    // i = client index
+    for (int i = 1; i <= MaxClients; i++)
+    {
+        // Validate awards
+        if (gLedgerData[i].Pending)
+        {
+            // Commit awards
+            LedgerOnCommit(i);
+        }
+    }
+}
+
+/**
+ * @brief Commits the pending awards of a client.
+ *
+ * @note Each award type fires one forward, one database update and one hud update.
+ *
+ * @param client            The client index.
+ **/
+void LedgerOnCommit(int client)
+{
+    // Gets pending awards
+    int iMoney = gLedgerData[client].Money;
+    int iExp = gLedgerData[client].Exp;
+
+    // Resets awards
+    gLedgerData[client].Money = 0;
+    gLedgerData[client].Exp = 0;
+    gLedgerData[client].Pending = false;
+
+    // Validate client
+    if (!IsPlayerExist(client, false))
+    {
+        return;
+    }
+
+    // Validate money
+    if (iMoney)
+    {
+        // Give money for the client
+        AccountSetClientCash(client, gClientData[client].Money + iMoney);
+    }
+
+    // Validate experience
+    if (iExp)
+    {
+        // Give experience for the client
+        LevelSystemOnSetExp(client, gClientData[client].Exp + iExp);
+    }
+
+    // Update the counter
+    gLedgerCommits++;
+}
@@ -274,6 +274,41 @@ int LevelSystemGetLimit(int iLevel)
     return gServerData.Levels.Get(iLevel-1);
 }
 
+/**
+ * @brief Finds the level for a given experience.
+ *
+ * @note Limits are unique and sorted in ascending order,
+ *       so the first limit above the experience gives the level.
+ * 
+ * @param iExp              The experience amount.
+ * @return                  The level amount. (may exceed max level)
+ **/ 
+int LevelSystemFindLevel(int iExp)
+{
+    // Initialize bounds
+    int iLow = 0; int iHigh = gServerData.Levels.Length;
+    
+    // Do binary search!
+    while (iLow < iHigh)
+    {
+        // Gets middle index
+        int iMid = (iLow + iHigh) / 2;
+        
+        // Validate limit
+        if (gServerData.Levels.Get(iMid) <= iExp)
+        {
+            iLow = iMid + 1;
+        }
+        else
+        {
+            iHigh = iMid;
+        }
+    }
+    
+    // Return the value 
+    return iLow + 1;
+}
+
 /*
  * Level main functions.
  */
@@ -337,7 +372,7 @@ void LevelSystemOnSetLvl(int client, int iLevel)
     }
 
     // Call forward
-    gForwardData._OnClientLevel(client, iLevel);
+    gForwardData._OnClientLevel(client, iLevel, gClientData[client].Level);
 
     // If amount below 0, then set to 1
     if (iLevel <= 0)
@@ -408,11 +443,17 @@ void LevelSystemOnSetExp(int client, int iExp)
     }
     else
     {
-        // Count through experience
-        while (gClientData[client].Level < iMaxLevel && gClientData[client].Exp >= LevelSystemGetLimit(gClientData[client].Level))
+        // Find the level through experience
+        int iLevel = LevelSystemFindLevel(gClientData[client].Exp);
+        if (iLevel > iMaxLevel)
+        {
+            iLevel = iMaxLevel;
+        }
+        
+        // Increase level once
+        if (iLevel > gClientData[client].Level)
         {
-            // Increase level
-            LevelSystemOnSetLvl(client, gClientData[client].Level + 1);
+            LevelSystemOnSetLvl(client, iLevel);
         }
     }
     
@@ -25,6 +25,66 @@
  * ============================================================================
  **/
 
+/**
+ * @section Properties of the spawn candidates.
+ **/
+#define SPAWN_CANDIDATE_MAX       4096      /** Max amount of cached candidates. */
+#define SPAWN_CANDIDATE_RINGS     2         /** Amount of sampling rings around each map spawn. */
+#define SPAWN_CANDIDATE_SIDES     8         /** Amount of samples per ring. */
+#define SPAWN_CANDIDATE_STEP      80.0      /** Distance between sampling rings. */
+#define SPAWN_CANDIDATE_SPACING   32.0      /** Min distance between two candidates. */
+#define SPAWN_CANDIDATE_DROP      128.0     /** Max distance from the sample down to the floor. */
+#define SPAWN_CANDIDATE_RADIUS    64.0      /** Distance to a player which marks the candidate as occupied. */
+#define SPAWN_CANDIDATE_INTERVAL  8         /** Amount of ticks between occupancy updates. */
+#define SPAWN_GRID_CELL           128.0     /** Size of the occupancy grid cell. */
+#define SPAWN_GRID_SIZE           1024      /** Amount of the occupancy grid buckets. */
+#define SPAWN_CANDIDATE_HELD      -1.0      /** Reservation which is kept until the candidate is freed. */
+/**
+ * @endsection
+ **/
+
+/**
+ * @section Sources of the spawn candidates.
+ **/
+enum SpawnSource
+{
+    SpawnSource_Map,              /** Samples around the map spawns. */
+    SpawnSource_Nav,              /** Centers of the nav areas. */
+    SpawnSource_Custom,           /** Any other positions added by addons. */
+    
+    SpawnSource_Max
+};
+/**
+ * @endsection
+ **/
+ 
+/**
+ * @section Properties of the spawn points.
+ **/
+#define SPAWN_POINT_MAX           256       /** Max amount of cached map spawns. */
+#define SPAWN_POINT_RADIUS        64.0      /** Distance to a player which marks the spawn as occupied. */
+#define SPAWN_POINT_COOLDOWN      2.0       /** Time in seconds before the used spawn is preferred again. */
+/**
+ * @endsection
+ **/
+
+/**
+ * Arrays to store the spawn candidates.
+ **/
+float gSpawnCandidate[SPAWN_CANDIDATE_MAX][3]; float gSpawnReserve[SPAWN_CANDIDATE_MAX]; int gSpawnSlot[SPAWN_CANDIDATE_MAX]; int gSpawnMark[SPAWN_CANDIDATE_MAX]; int gSpawnNext[SPAWN_CANDIDATE_MAX]; SpawnSource gSpawnSource[SPAWN_CANDIDATE_MAX];
+int gSpawnFree[SpawnSource_Max][SPAWN_CANDIDATE_MAX]; int gSpawnFreeCount[SpawnSource_Max]; int gSpawnBusy[SPAWN_CANDIDATE_MAX]; int gSpawnGrid[SPAWN_GRID_SIZE]; int gSpawnCount; int gSpawnBusyCount; int gSpawnEpoch;
+StringMap gSpawnKeys;
+
+/**
+ * Arrays to store the player snapshot.
+ **/
+float gSpawnPlayerOrigin[MAXPLAYERS+1][3]; int gSpawnPlayerClient[MAXPLAYERS+1]; int gSpawnPlayerCount; int gSpawnTick;
+
+/**
+ * Arrays to store the spawn points.
+ **/
+int gSpawnPointTeam[SPAWN_POINT_MAX]; int gSpawnPointLoad[SPAWN_POINT_MAX]; float gSpawnPointCooldown[SPAWN_POINT_MAX]; int gSpawnPointTick = -1;
+
 /**
  * @brief Spawn module init function.
  **/
@@ -35,6 +95,40 @@ void SpawnOnInit(/*void*/)
     
     // Initialize a spawn position array
     gServerData.Spawns = new ArrayList(3); 
+    
+    // Initialize a candidate key map
+    gSpawnKeys = new StringMap();
+    
+    // Resets candidates
+    SpawnOnPurge();
+}
+
+/**
+ * @brief Spawn module purge function.
+ **/
+void SpawnOnPurge(/*void*/)
+{
+    // i = bucket index
+    for (int i = 0; i < SPAWN_GRID_SIZE; i++)
+    {
+        // Clear bucket
+        gSpawnGrid[i] = -1;
+    }
+    
+    // i = source index
+    for (SpawnSource i = SpawnSource_Map; i < SpawnSource_Max; i++)
+    {
+        // Clear free list
+        gSpawnFreeCount[i] = 0;
+    }
+    
+    // Clear out the map of all data
+    gSpawnKeys.Clear();
+    
+    // Resets variables
+    gSpawnCount = 0;
+    gSpawnBusyCount = 0;
+    gSpawnPlayerCount = 0;
 }
 
 /**
@@ -46,8 +140,8 @@ void SpawnOnLoad(/*void*/)
     gServerData.Spawns.Clear();
     
     // Now copy positions to array structure
-    SpawnOnCacheData("info_player_terrorist");
-    SpawnOnCacheData("info_player_counterterrorist");
+    SpawnOnCacheData("info_player_terrorist", TEAM_ZOMBIE);
+    SpawnOnCacheData("info_player_counterterrorist", TEAM_HUMAN);
     
     // If team spawns weren't found
     if (!gServerData.Spawns.Length)
@@ -57,28 +151,203 @@ void SpawnOnLoad(/*void*/)
         SpawnOnCacheData("info_player_start");
         SpawnOnCacheData("info_player_teamspawn");
     }
+    
+    // Resets occupancy
+    gSpawnPointTick = -1;
+    
+    // Sample candidates around spawns
+    SpawnOnCacheCandidates();
 }
 
 /**
  * @brief Caches spawn data from the server.
  *
  * @param sClassname        The string with info name. 
+ * @param iTeam             (Optional) The team of the spawn.
  **/
-void SpawnOnCacheData(char[] sClassname)
+void SpawnOnCacheData(char[] sClassname, int iTeam = TEAM_NONE)
 {
     // Loop throught all entities
     int entity;
     while ((entity = FindEntityByClassname(entity, sClassname)) != -1)
     {
+        // Validate size
+        int iD = gServerData.Spawns.Length;
+        if (iD >= SPAWN_POINT_MAX)
+        {
+            LogEvent(false, LogType_Error, LOG_GAME_EVENTS, LogModule_Classes, "Spawn Validation", "Map has more than \"%d\" spawns, the rest of \"%s\" are ignored", SPAWN_POINT_MAX, sClassname);
+            return;
+        }
+        
         // Gets origin position
         static float vPosition[3];
         ToolsGetAbsOrigin(entity, vPosition); 
         
         // Push data into array 
         gServerData.Spawns.PushArray(vPosition, sizeof(vPosition));
+        gSpawnPointTeam[iD] = iTeam;
+        gSpawnPointCooldown[iD] = 0.0;
+    }
+}
+
+/**
+ * @brief Samples the spawn candidates around the map spawns.
+ **/
+void SpawnOnCacheCandidates(/*void*/)
+{
+    // Initialize vectors
+    static float vSpawn[3]; static float vPosition[3]; static float vStart[3];
+    
+    // i = origin index
+    int iSize = gServerData.Spawns.Length;
+    for (int i = 0; i < iSize; i++)
+    {
+        // Gets spawn position
+        gServerData.Spawns.GetArray(i, vSpawn, sizeof(vSpawn));
+        
+        // Push spawn itself
+        SpawnCandidatePush(vSpawn, SpawnSource_Map);
+
+        // Lift the sight line from the floor
+        vStart = vSpawn; vStart[2] += SPAWN_CANDIDATE_SPACING;
+        
+        // r = ring index
+        for (int r = 1; r <= SPAWN_CANDIDATE_RINGS; r++)
+        {
+            // x = side index
+            for (int x = 0; x < SPAWN_CANDIDATE_SIDES; x++)
+            {
+                // Calculate sample position
+                float flAngle = 2.0 * FLOAT_PI * float(x) / float(SPAWN_CANDIDATE_SIDES);
+                vPosition[0] = vStart[0] + Cosine(flAngle) * SPAWN_CANDIDATE_STEP * float(r);
+                vPosition[1] = vStart[1] + Sine(flAngle) * SPAWN_CANDIDATE_STEP * float(r);
+                vPosition[2] = vStart[2];
+                
+                // Validate that sample is visible from the spawn
+                TR_TraceRayFilter(vStart, vPosition, MASK_PLAYERSOLID, RayType_EndPoint, SpawnCandidateFilter);
+                if (!TR_DidHit())
+                {
+                    // Push sample
+                    SpawnCandidatePush(vPosition, SpawnSource_Map);
+                }
+            }
+        }
     }
 }
 
+/**
+ * @brief Called before every server frame.
+ **/
+void SpawnOnFrame(/*void*/)
+{
+    // Validate interval
+    if (++gSpawnTick % SPAWN_CANDIDATE_INTERVAL == 0)
+    {
+        // Update player snapshot
+        gSpawnPlayerCount = 0;
+        
+        // i = client index
+        for (int i = 1; i <= MaxClients; i++)
+        {
+            // Validate client
+            if (IsPlayerExist(i))
+            {
+                // Gets client origin
+                gSpawnPlayerClient[gSpawnPlayerCount] = i;
+                GetClientAbsOrigin(i, gSpawnPlayerOrigin[gSpawnPlayerCount++]);
+            }
+        }
+    
+        // Update occupancy
+        SpawnOnUpdateCandidates();
+    }
+}
+
+/**
+ * @brief Updates the occupancy of the spawn candidates from the player snapshot.
+ **/
+void SpawnOnUpdateCandidates(/*void*/)
+{
+    // Validate candidates
+    if (!gSpawnCount)
+    {
+        return;
+    }
+    
+    // Initialize variables
+    static int iPending[SPAWN_CANDIDATE_MAX]; int iPendingCount; float flRadius = SPAWN_CANDIDATE_RADIUS * SPAWN_CANDIDATE_RADIUS;
+    gSpawnEpoch++;
+
+    // i = snapshot index
+    for (int i = 0; i < gSpawnPlayerCount; i++)
+    {
+        // Gets player cell
+        int cX = RoundToFloor(gSpawnPlayerOrigin[i][0] / SPAWN_GRID_CELL);
+        int cY = RoundToFloor(gSpawnPlayerOrigin[i][1] / SPAWN_GRID_CELL);
+        
+        // x/y = cell offset
+        for (int x = -1; x <= 1; x++)
+        {
+            for (int y = -1; y <= 1; y++)
+            {
+                // c = candidate index
+                for (int c = gSpawnGrid[SpawnGetGridBucket(cX + x, cY + y)]; c != -1; c = gSpawnNext[c])
+                {
+                    // Validate mark
+                    if (gSpawnMark[c] == gSpawnEpoch)
+                    {
+                        continue;
+                    }
+                    
+                    // Validate distance
+                    if (GetVectorDistance(gSpawnPlayerOrigin[i], gSpawnCandidate[c], true) > flRadius)
+                    {
+                        continue;
+                    }
+                    
+                    // Mark as occupied
+                    gSpawnMark[c] = gSpawnEpoch;
+                    
+                    // Remove from free list
+                    if (gSpawnSlot[c] != -1)
+                    {
+                        SpawnCandidateDetach(c);
+                        iPending[iPendingCount++] = c;
+                    }
+                }
+            }
+        }
+    }
+    
+    // Gets current time
+    float flCurrentTime = GetGameTime(); int iBusy;
+    
+    // i = busy index
+    for (int i = 0; i < gSpawnBusyCount; i++)
+    {
+        // Validate occupation or reservation
+        int c = gSpawnBusy[i];
+        if (gSpawnMark[c] == gSpawnEpoch || gSpawnReserve[c] == SPAWN_CANDIDATE_HELD || gSpawnReserve[c] > flCurrentTime)
+        {
+            // Keep busy
+            gSpawnBusy[iBusy++] = c;
+        }
+        else
+        {
+            // Push into free list
+            SpawnCandidateAttach(c);
+        }
+    }
+    
+    // i = pending index
+    for (int i = 0; i < iPendingCount; i++)
+    {
+        // Push into busy list
+        gSpawnBusy[iBusy++] = iPending[i];
+    }
+    gSpawnBusyCount = iBusy;
+}
+
 /**
  * @brief Creates commands for spawn module.
  **/
@@ -241,25 +510,104 @@ public Action SpawnOnClientSpawn(Event hEvent, char[] sName, bool dontBroadcast)
 }
 
 /**
- * @brief Teleport client to a random spawn position.
+ * @brief Teleport client to the least occupied spawn position.
  * 
+ * @note Spawns picked in the same tick are counted as occupied, 
+ *       so the batch of respawns gets distinct points.
+ *
  * @param client            The client index.
+ * @param iTeam             (Optional) The team of spawns, or TEAM_NONE for all.
+ * @return                  True on success, false otherwise.
  **/
-void SpawnTeleportToRespawn(int client)
+bool SpawnTeleportToRespawn(int client, int iTeam = TEAM_NONE)
 {
+    // Validate spawns
+    int iSize = gServerData.Spawns.Length;
+    if (!iSize)
+    {
+        return false;
+    }
+    
+    // Update occupancy once per tick
+    if (gSpawnPointTick != gSpawnTick)
+    {
+        SpawnOnUpdatePoints();
+    }
+    
+    // x = snapshot index
+    int iSelf = -1;
+    for (int x = 0; x < gSpawnPlayerCount; x++)
+    {
+        // Validate client
+        if (gSpawnPlayerClient[x] == client)
+        {
+            iSelf = x;
+            break;
+        }
+    }
+    
+    // Exclude the client from the occupancy
+    if (iSelf != -1)
+    {
+        SpawnOnLoadPoints(gSpawnPlayerOrigin[iSelf], -1);
+        gSpawnPlayerClient[iSelf] = 0;
+    }
+
     // Initialize vectors
     static float vPosition[3]; float vMaxs[3]; float vMins[3]; 
 
     // Gets client's min and max size vector
     GetClientMins(client, vMins);
     GetClientMaxs(client, vMaxs);
-
+    
+    // Initialize variables
+    static bool bTried[SPAWN_POINT_MAX]; float flCurrentTime = GetGameTime(); int iOffset = GetRandomInt(0, iSize - 1);
+    
     // i = origin index
-    int iSize = gServerData.Spawns.Length;
     for (int i = 0; i < iSize; i++)
     {
-        // Gets random array
-        gServerData.Spawns.GetArray(i, vPosition, sizeof(vPosition));
+        bTried[i] = false;
+    }
+    
+    // Try spawns from the least occupied
+    for (int iTry = 0; iTry < iSize; iTry++)
+    {
+        // Find the best spawn
+        int iD = -1; int iBest;
+        for (int x = 0; x < iSize; x++)
+        {
+            // Start from random spawn to spread the ties
+            int i = (x + iOffset) % iSize;
+            
+            // Validate spawn
+            if (bTried[i] || (iTeam != TEAM_NONE && gSpawnPointTeam[i] != TEAM_NONE && gSpawnPointTeam[i] != iTeam))
+            {
+                continue;
+            }
+            
+            // Occupied spawns are worse than the cooldown ones
+            int iScore = gSpawnPointLoad[i] * 2 + view_as<int>(gSpawnPointCooldown[i] > flCurrentTime);
+            if (iD == -1 || iScore < iBest)
+            {
+                iD = i; iBest = iScore;
+                
+                // Validate free spawn
+                if (!iScore)
+                {
+                    break;
+                }
+            }
+        }
+        
+        // Validate spawn
+        if (iD == -1)
+        {
+            return false;
+        }
+        bTried[iD] = true;
+
+        // Gets spawn position
+        gServerData.Spawns.GetArray(iD, vPosition, sizeof(vPosition));
         
         // Create the hull trace
         TR_TraceHullFilter(vPosition, vPosition, vMins, vMaxs, MASK_SOLID, AntiStickFilter, client);
@@ -267,9 +615,333 @@ void SpawnTeleportToRespawn(int client)
         // Returns if there was any kind of collision along the trace ray
         if (!TR_DidHit())
         {
+            // Claim spawn
+            gSpawnPointLoad[iD]++;
+            gSpawnPointCooldown[iD] = flCurrentTime + SPAWN_POINT_COOLDOWN;
+            
             // Teleport player back on the spawn point
             TeleportEntity(client, vPosition, NULL_VECTOR, NULL_VECTOR);
-            return;
+            return true;
+        }
+    }
+    
+    // Client stays on the place, so restore the occupancy
+    if (iSelf != -1)
+    {
+        SpawnOnLoadPoints(gSpawnPlayerOrigin[iSelf], 1);
+        gSpawnPlayerClient[iSelf] = client;
+    }
+    
+    // Return on unsuccess
+    return false;
+}
+
+/**
+ * @brief Updates the occupancy of the spawn points from the player snapshot.
+ **/
+void SpawnOnUpdatePoints(/*void*/)
+{
+    // Initialize variables
+    static float vPosition[3]; float flRadius = SPAWN_POINT_RADIUS * SPAWN_POINT_RADIUS;
+    
+    // i = origin index
+    int iSize = gServerData.Spawns.Length;
+    for (int i = 0; i < iSize; i++)
+    {
+        // Gets spawn position
+        gServerData.Spawns.GetArray(i, vPosition, sizeof(vPosition));
+        
+        // Resets load
+        gSpawnPointLoad[i] = 0;
+        
+        // x = snapshot index
+        for (int x = 0; x < gSpawnPlayerCount; x++)
+        {
+            // Validate client and distance (teleported ones are excluded)
+            if (gSpawnPlayerClient[x] && GetVectorDistance(vPosition, gSpawnPlayerOrigin[x], true) <= flRadius)
+            {
+                gSpawnPointLoad[i]++;
+            }
         }
     }
-}
\ No newline at end of file
+    
+    // Sets tick of the update
+    gSpawnPointTick = gSpawnTick;
+}
+
+/**
+ * @brief Changes the occupancy of the spawn points around the position.
+ *
+ * @param vOrigin           The position vector.
+ * @param iAmount           The amount to add to the load.
+ **/
+void SpawnOnLoadPoints(float vOrigin[3], int iAmount)
+{
+    // Initialize variables
+    static float vPosition[3]; float flRadius = SPAWN_POINT_RADIUS * SPAWN_POINT_RADIUS;
+    
+    // i = origin index
+    int iSize = gServerData.Spawns.Length;
+    for (int i = 0; i < iSize; i++)
+    {
+        // Gets spawn position
+        gServerData.Spawns.GetArray(i, vPosition, sizeof(vPosition));
+        
+        // Validate distance
+        if (GetVectorDistance(vPosition, vOrigin, true) <= flRadius)
+        {
+            gSpawnPointLoad[i] += iAmount;
+        }
+    }
+}
+
+/*
+ * Spawn natives API.
+ */
+
+/**
+ * @brief Sets up natives for library.
+ **/
+void SpawnOnNativeInit(/*void*/)
+{
+    CreateNative("ZP_AddSpawnCandidate",       API_AddSpawnCandidate);
+    CreateNative("ZP_GetRandomSpawnCandidate", API_GetRandomSpawnCandidate);
+    CreateNative("ZP_FreeSpawnCandidate",      API_FreeSpawnCandidate);
+}
+
+/**
+ * @brief Validates and caches the position as a spawn candidate.
+ *
+ * @note native int ZP_AddSpawnCandidate(position, source);
+ **/
+public int API_AddSpawnCandidate(Handle hPlugin, int iNumParams)
+{
+    // Gets source from native cell
+    SpawnSource iSource = GetNativeCell(2);
+    
+    // Validate source
+    if (iSource < SpawnSource_Map || iSource >= SpawnSource_Max)
+    {
+        LogEvent(false, LogType_Native, LOG_GAME_EVENTS, LogModule_Classes, "Native Validation", "Invalid the source index (%d)", iSource);
+        return -1;
+    }
+    
+    // Gets position from native cell
+    static float vPosition[3];
+    GetNativeArray(1, vPosition, sizeof(vPosition));
+
+    // Return the index
+    return SpawnCandidatePush(vPosition, iSource);
+}
+
+/**
+ * @brief Gets the random free spawn candidate.
+ *
+ * @note native int ZP_GetRandomSpawnCandidate(position, source, reserve);
+ **/
+public int API_GetRandomSpawnCandidate(Handle hPlugin, int iNumParams)
+{
+    // Gets source from native cell
+    SpawnSource iSource = GetNativeCell(2);
+    
+    // Validate source
+    if (iSource < SpawnSource_Map || iSource >= SpawnSource_Max)
+    {
+        LogEvent(false, LogType_Native, LOG_GAME_EVENTS, LogModule_Classes, "Native Validation", "Invalid the source index (%d)", iSource);
+        return -1;
+    }
+    
+    // Gets candidate
+    static float vPosition[3];
+    int iD = SpawnCandidatePop(vPosition, iSource, GetNativeCell(3));
+    if (iD == -1)
+    {
+        return -1;
+    }
+    
+    // Return on success
+    SetNativeArray(1, vPosition, sizeof(vPosition));
+    return iD;
+}
+
+/**
+ * @brief Frees the held spawn candidate.
+ *
+ * @note native void ZP_FreeSpawnCandidate(candidate);
+ **/
+public int API_FreeSpawnCandidate(Handle hPlugin, int iNumParams)
+{
+    // Gets candidate from native cell
+    int iD = GetNativeCell(1);
+    
+    // Validate index (candidates of the previous map are gone)
+    if (iD < 0 || iD >= gSpawnCount)
+    {
+        return;
+    }
+    
+    // Drop reservation, occupancy update will return it into free list
+    gSpawnReserve[iD] = 0.0;
+}
+
+/*
+ * Spawn candidates functions.
+ */
+
+/**
+ * @brief Validates and caches the position as a spawn candidate.
+ *
+ * @param vPosition         The position vector.
+ * @param iSource           The source of the candidate.
+ * @return                  The candidate index, or -1 if the position is invalid.
+ **/
+int SpawnCandidatePush(float vPosition[3], SpawnSource iSource)
+{
+    // Validate size
+    if (gSpawnCount >= SPAWN_CANDIDATE_MAX)
+    {
+        return -1;
+    }
+
+    // Initialize vectors
+    static float vStart[3]; static float vEnd[3]; static float vNormal[3];
+    
+    // Initialize the player hull vectors
+    static const float vMins[3] = { -16.0, -16.0, 0.0  }; 
+    static const float vMaxs[3] = {  16.0,  16.0, 72.0 }; 
+    
+    // Create the floor trace
+    vStart = vPosition; vStart[2] += 16.0;
+    vEnd = vPosition;   vEnd[2] -= SPAWN_CANDIDATE_DROP;
+    TR_TraceRayFilter(vStart, vEnd, MASK_PLAYERSOLID, RayType_EndPoint, SpawnCandidateFilter);
+    
+    // Validate floor
+    if (!TR_DidHit())
+    {
+        return -1;
+    }
+    
+    // Validate slope
+    TR_GetPlaneNormal(null, vNormal);
+    if (vNormal[2] < 0.7)
+    {
+        return -1;
+    }
+    
+    // Gets floor position
+    TR_GetEndPosition(vEnd); vEnd[2] += 1.0;
+    
+    // Validate duplicates
+    static char sKey[SMALL_LINE_LENGTH]; int iD;
+    FormatEx(sKey, sizeof(sKey), "%d %d %d %d", iSource, RoundToFloor(vEnd[0] / SPAWN_CANDIDATE_SPACING), RoundToFloor(vEnd[1] / SPAWN_CANDIDATE_SPACING), RoundToFloor(vEnd[2] / SPAWN_CANDIDATE_SPACING));
+    if (gSpawnKeys.GetValue(sKey, iD))
+    {
+        return iD;
+    }
+    
+    // Create the hull trace
+    TR_TraceHullFilter(vEnd, vEnd, vMins, vMaxs, MASK_PLAYERSOLID, SpawnCandidateFilter);
+    
+    // Returns if there was any kind of collision along the trace ray
+    if (TR_DidHit())
+    {
+        return -1;
+    }
+    
+    // Push data into arrays
+    iD = gSpawnCount++;
+    gSpawnCandidate[iD] = vEnd;
+    gSpawnReserve[iD] = 0.0;
+    gSpawnMark[iD] = 0;
+    gSpawnSource[iD] = iSource;
+    gSpawnKeys.SetValue(sKey, iD);
+    
+    // Push into grid bucket
+    int iBucket = SpawnGetGridBucket(RoundToFloor(vEnd[0] / SPAWN_GRID_CELL), RoundToFloor(vEnd[1] / SPAWN_GRID_CELL));
+    gSpawnNext[iD] = gSpawnGrid[iBucket];
+    gSpawnGrid[iBucket] = iD;
+    
+    // Push into free list
+    SpawnCandidateAttach(iD);
+    return iD;
+}
+
+/**
+ * @brief Takes the random free spawn candidate.
+ *
+ * @param vPosition         The position output.
+ * @param iSource           The source of the candidate.
+ * @param flReserve         The time in seconds for which the candidate stays occupied, or negative to hold it until freed.
+ * @return                  The candidate index, or -1 if there are no free candidates.
+ **/
+int SpawnCandidatePop(float vPosition[3], SpawnSource iSource, float flReserve)
+{
+    // Validate free candidates
+    int iCount = gSpawnFreeCount[iSource];
+    if (!iCount)
+    {
+        return -1;
+    }
+    
+    // Gets random candidate
+    int iD = gSpawnFree[iSource][GetRandomInt(0, iCount - 1)];
+    vPosition = gSpawnCandidate[iD];
+
+    // Move into busy list
+    gSpawnReserve[iD] = (flReserve < 0.0) ? SPAWN_CANDIDATE_HELD : GetGameTime() + flReserve;
+    SpawnCandidateDetach(iD);
+    gSpawnBusy[gSpawnBusyCount++] = iD;
+    return iD;
+}
+
+/**
+ * @brief Pushes the candidate into the free list.
+ *
+ * @param iD                The candidate index.
+ **/
+void SpawnCandidateAttach(int iD)
+{
+    SpawnSource iSource = gSpawnSource[iD];
+    gSpawnSlot[iD] = gSpawnFreeCount[iSource];
+    gSpawnFree[iSource][gSpawnFreeCount[iSource]++] = iD;
+}
+
+/**
+ * @brief Removes the candidate from the free list.
+ *
+ * @param iD                The candidate index.
+ **/
+void SpawnCandidateDetach(int iD)
+{
+    // Swap with the last candidate of the same source
+    SpawnSource iSource = gSpawnSource[iD];
+    int iSlot = gSpawnSlot[iD];
+    int iLast = gSpawnFree[iSource][--gSpawnFreeCount[iSource]];
+    gSpawnFree[iSource][iSlot] = iLast;
+    gSpawnSlot[iLast] = iSlot;
+    gSpawnSlot[iD] = -1;
+}
+
+/**
+ * @brief Gets the occupancy grid bucket of the cell.
+ *
+ * @param cX                The cell x coordinate.
+ * @param cY                The cell y coordinate.
+ * @return                  The bucket index.
+ **/
+int SpawnGetGridBucket(int cX, int cY)
+{
+    return ((cX * 73856093) ^ (cY * 19349663)) & (SPAWN_GRID_SIZE - 1);
+}
+
+/**
+ * @brief Trace filter.
+ *
+ * @param entity            The entity index.  
+ * @param contentsMask      The contents mask.
+ * @return                  True or false.
+ **/
+public bool SpawnCandidateFilter(int entity, int contentsMask)
+{
+    return !(1 <= entity <= MaxClients);
+}
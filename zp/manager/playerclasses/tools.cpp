@@ -562,6 +562,7 @@ void ToolsOnNativeInit(/*void*/)
     CreateNative("ZP_UpdateTransmitState",  API_UpdateTransmitState);
     CreateNative("ZP_RespawnPlayer",        API_RespawnPlayer);
     CreateNative("ZP_FindPlayerInSphere",   API_FindPlayerInSphere);
+    CreateNative("ZP_ApplyRadiusEffect",    API_ApplyRadiusEffect);
     CreateNative("ZP_SetProgressBarTime",   API_SetProgressBarTime);
 }
 
@@ -921,6 +922,49 @@ public int API_FindPlayerInSphere(Handle hPlugin, int iNumParams)
     return client;
 }
 
+/**
+ * @brief Applies damage, knockback, shake and fade to all players within a sphere.
+ *
+ * @note native int ZP_ApplyRadiusEffect(attacker, inflictor, center, radius, team, victims, maxVictims, damage, falloff, bits, knockback, shakeAmp, shakeFrequency, shakeDuration, fadeDuration, fadeTime, fadeColor, fadeFlags);
+ **/
+public int API_ApplyRadiusEffect(Handle hPlugin, int iNumParams)
+{
+    // Gets origin vector
+    static float vPosition[3];
+    GetNativeArray(3, vPosition, sizeof(vPosition));
+    
+    // Gets radius from native cell
+    float flRadius = GetNativeCell(4);
+    
+    // Validate radius
+    if (flRadius <= 0.0)
+    {
+        LogEvent(false, LogType_Native, LOG_GAME_EVENTS, LogModule_Tools, "Native Validation", "Invalid the radius (%.2f)", flRadius);
+        return 0;
+    }
+    
+    // Gets fade color
+    static int vColor[4];
+    GetNativeArray(17, vColor, sizeof(vColor));
+
+    // Apply the effect
+    static int iVictims[MAXPLAYERS+1];
+    int iCount = ToolsApplyRadiusEffect(GetNativeCell(1), GetNativeCell(2), vPosition, flRadius, GetNativeCell(5), iVictims, GetNativeCell(8), GetNativeCell(9), GetNativeCell(10), GetNativeCell(11), GetNativeCell(12), GetNativeCell(13), GetNativeCell(14), GetNativeCell(15), GetNativeCell(16), vColor, GetNativeCell(18));
+    
+    // Clamp to the victims output size
+    int iMaxLen = GetNativeCell(7);
+    if (iCount > iMaxLen) iCount = (iMaxLen > 0) ? iMaxLen : 0;
+    
+    // Gets the victims output
+    if (iCount)
+    {
+        SetNativeArray(6, iVictims, iCount);
+    }
+    
+    // Return on the success
+    return iCount;
+}
+
 /**
  * @brief Sets the player progress bar.
  *
@@ -30,6 +30,33 @@
  **/
 UserMsg hTextMsg; UserMsg hHintText; char sEmpty[FILE_LINE_LENGTH] = "";
 
+/**
+ * @section Struct of the hint message which is re-sent on the next frame.
+ **/
+enum struct HintMessage
+{
+    int Players[MAXPLAYERS+1];
+    int Count;
+    char Text[FILE_LINE_LENGTH];
+}
+/**
+ * @endsection
+ **/
+
+/**
+ * @section Struct of the blocked message entry.
+ **/
+enum struct MessageBlock
+{
+    char Key[NORMAL_LINE_LENGTH];
+    int Length;
+    bool Prefix;
+    int Count;
+}
+/**
+ * @endsection
+ **/
+
 /**
  * @brief Creates commands for tools module.
  **/
@@ -53,6 +80,9 @@ void ToolsOnCommandInit(/*void*/)
     HookUserMessage(hTextMsg, ToolsOnMessageHook, true);
     HookUserMessage(hTextMsg, ToolsOnHintHook, true);
     HookUserMessage(hHintText, ToolsOnHintHook, true);
+
+    // Create commands
+    RegAdminCmd("zp_messages_block_stats", ToolsBlockOnCommandCatched, ADMFLAG_CONFIG, "Prints the blocked and re-sent messages statistics.");
 }
 
 /**
@@ -66,6 +96,7 @@ void ToolsOnCvarInit(/*void*/)
     gCvarList.MESSAGES_COUNTER      = FindConVar("zp_messages_counter");
     gCvarList.MESSAGES_BLAST        = FindConVar("zp_messages_blast");
     gCvarList.MESSAGES_DAMAGE       = FindConVar("zp_messages_damage");
+    gCvarList.MESSAGES_DAMAGE_INTERVAL = FindConVar("zp_messages_damage_interval");
     gCvarList.MESSAGES_DONATE       = FindConVar("zp_messages_donate");
     gCvarList.MESSAGES_CLASS_INFO   = FindConVar("zp_messages_class_info");
     gCvarList.MESSAGES_CLASS_CHOOSE = FindConVar("zp_messages_class_choose");
@@ -84,9 +115,156 @@ void ToolsOnCvarInit(/*void*/)
     // Hook cvars
     HookConVarChange(gCvarList.LIGHT_BUTTON, ToolsFOnCvarHook);
     HookConVarChange(gCvarList.SEND_TABLES,  CvarsUnlockOnCvarHook);
-    
+    HookConVarChange(gCvarList.MESSAGES_BLOCK, ToolsBlockOnCvarHook);
+
     // Load cvars
     ToolsOnCommandLoad();
+    ToolsOnBlockLoad();
+}
+
+/**
+ * @brief Compiles the blocked messages list.
+ *
+ * @note Keys are separated by spaces or commas, the leading '#' is optional.
+ *       The key which ends with '*' is matched as a prefix.
+ **/
+void ToolsOnBlockLoad(/*void*/)
+{
+    // Validate lists
+    if (gServerData.MessageBlocks == null)
+    {
+        // Initialize a block list
+        gServerData.MessageBlocks = new ArrayList(sizeof(MessageBlock));
+        gServerData.MessagePrefixes = new ArrayList();
+        gServerData.MessageKeys = new StringMap();
+    }
+    else
+    {
+        // Clear out the lists
+        gServerData.MessageBlocks.Clear();
+        gServerData.MessagePrefixes.Clear();
+        gServerData.MessageKeys.Clear();
+    }
+
+    // Gets block message list
+    static char sBlock[PLATFORM_LINE_LENGTH];
+    gCvarList.MESSAGES_BLOCK.GetString(sBlock, sizeof(sBlock));
+    ReplaceString(sBlock, sizeof(sBlock), ",", " ");
+
+    // Split the list into keys
+    static char sKey[SMALL_LINE_LENGTH][NORMAL_LINE_LENGTH];
+    int nKeys = ExplodeString(sBlock, " ", sKey, sizeof(sKey), sizeof(sKey[]));
+
+    // i = key index
+    MessageBlock hBlock;
+    for (int i = 0; i < nKeys; i++)
+    {
+        // Trim string and skip the leading '#'
+        TrimString(sKey[i]);
+        strcopy(hBlock.Key, sizeof(hBlock.Key), sKey[i][(sKey[i][0] == '#') ? 1 : 0]);
+        StringToLower(hBlock.Key); /// Keys are matched ignoring case
+
+        // Validate key
+        hBlock.Length = strlen(hBlock.Key);
+        if (!hBlock.Length)
+        {
+            continue;
+        }
+
+        // Validate prefix
+        hBlock.Prefix = (hBlock.Key[hBlock.Length - 1] == '*');
+        if (hBlock.Prefix)
+        {
+            hBlock.Key[--hBlock.Length] = NULL_STRING[0];
+
+            // Validate key
+            if (!hBlock.Length)
+            {
+                continue;
+            }
+
+            // Push prefix into the list
+            gServerData.MessagePrefixes.Push(gServerData.MessageBlocks.Length);
+        }
+        else if (!gServerData.MessageKeys.SetValue(hBlock.Key, gServerData.MessageBlocks.Length, false))
+        {
+            continue;
+        }
+
+        // Push data into array
+        hBlock.Count = 0;
+        gServerData.MessageBlocks.PushArray(hBlock, sizeof(hBlock));
+    }
+}
+
+/**
+ * Cvar hook callback (zp_messages_block)
+ * @brief Recompiles the blocked messages list.
+ *
+ * @param hConVar           The cvar handle.
+ * @param oldValue          The value before the attempted change.
+ * @param newValue          The new value.
+ **/
+public void ToolsBlockOnCvarHook(ConVar hConVar, char[] oldValue, char[] newValue)
+{
+    // Validate new value
+    if (!strcmp(oldValue, newValue, false))
+    {
+        return;
+    }
+
+    // Forward event to modules
+    ToolsOnBlockLoad();
+}
+
+/**
+ * Console command callback (zp_messages_block_stats)
+ * @brief Prints the blocked and re-sent messages statistics.
+ *
+ * @param client            The client index.
+ * @param iArguments        The number of arguments that were in the argument string.
+ **/
+public Action ToolsBlockOnCommandCatched(int client, int iArguments)
+{
+    // Initialize variables
+    static char sBuffer[HUGE_LINE_LENGTH]; sBuffer[0] = NULL_STRING[0];
+    static char sLine[BIG_LINE_LENGTH];
+
+    // Format strings
+    FormatEx(sLine, sizeof(sLine), "%41s: %d\n", "Re-sent hints", gServerData.HintResent);
+    StrCat(sBuffer, sizeof(sBuffer), sLine);
+
+    // Validate list
+    if (gServerData.MessageBlocks == null)
+    {
+        // Send information into the console
+        ReplyToCommand(client, sBuffer);
+        return Plugin_Handled;
+    }
+
+    // i = block index
+    MessageBlock hBlock; int iSize = gServerData.MessageBlocks.Length;
+    for (int i = 0; i < iSize; i++)
+    {
+        // Gets block data
+        gServerData.MessageBlocks.GetArray(i, hBlock, sizeof(hBlock));
+
+        // Format strings
+        FormatEx(sLine, sizeof(sLine), "%40s%s: %d\n", hBlock.Key, hBlock.Prefix ? "*" : " ", hBlock.Count);
+
+        // Validate buffer size
+        if (strlen(sBuffer) + strlen(sLine) >= sizeof(sBuffer))
+        {
+            // Send information into the console
+            ReplyToCommand(client, sBuffer);
+            sBuffer[0] = NULL_STRING[0];
+        }
+        StrCat(sBuffer, sizeof(sBuffer), sLine);
+    }
+
+    // Send information into the console
+    ReplyToCommand(client, sBuffer);
+    return Plugin_Handled;
 }
 
 /**
@@ -207,15 +385,68 @@ public Action ToolsOnCommandListened(int client, char[] commandMsg, int iArgumen
 public Action ToolsOnMessageHook(UserMsg hMessage, Protobuf hMsg, const int[] iPlayers, int playersNum, bool bReliable, bool bInit)
 {
     // Initialize message
-    static char sBuffer[PLATFORM_LINE_LENGTH]; 
+    static char sBuffer[PLATFORM_LINE_LENGTH];
     hMsg.ReadString("params", sBuffer, sizeof(sBuffer), 0);
 
-    // Initialize block message list
-    static char sBlock[PLATFORM_LINE_LENGTH];
-    gCvarList.MESSAGES_BLOCK.GetString(sBlock, sizeof(sBlock)); 
+    // Validate list
+    if (gServerData.MessageBlocks == null)
+    {
+        return Plugin_Continue;
+    }
+
+    // Skip the leading '#'
+    int iOffset = (sBuffer[0] == '#') ? 1 : 0;
+    StringToLower(sBuffer);
+
+    // Find the exact key
+    int iD;
+    if (!gServerData.MessageKeys.GetValue(sBuffer[iOffset], iD))
+    {
+        // i = prefix index
+        iD = -1; int iSize = gServerData.MessagePrefixes.Length;
+        for (int i = 0; i < iSize; i++)
+        {
+            // Validate prefix
+            int iIndex = gServerData.MessagePrefixes.Get(i);
+            if (ToolsMatchBlock(iIndex, sBuffer[iOffset]))
+            {
+                iD = iIndex;
+                break;
+            }
+        }
 
-    // Block messages on the matching
-    return (StrContains(sBlock, sBuffer, false) != -1) ? Plugin_Handled : Plugin_Continue; 
+        // Validate match
+        if (iD == -1)
+        {
+            return Plugin_Continue;
+        }
+    }
+
+    // Update the counter
+    MessageBlock hBlock;
+    gServerData.MessageBlocks.GetArray(iD, hBlock, sizeof(hBlock));
+    hBlock.Count++;
+    gServerData.MessageBlocks.SetArray(iD, hBlock, sizeof(hBlock));
+
+    // Block message
+    return Plugin_Handled;
+}
+
+/**
+ * @brief Checks the message against a prefix entry.
+ *
+ * @param iD                The block index.
+ * @param sMessage          The message key.
+ * @return                  True if the prefix matches, false otherwise.
+ **/
+bool ToolsMatchBlock(int iD, const char[] sMessage)
+{
+    // Gets block data
+    static MessageBlock hBlock;
+    gServerData.MessageBlocks.GetArray(iD, hBlock, sizeof(hBlock));
+
+    // Compare prefix
+    return !strncmp(sMessage, hBlock.Key, hBlock.Length, false);
 }
 
 /**
@@ -248,20 +479,30 @@ public Action ToolsOnHintHook(UserMsg hMessage, Protobuf hMsg, const int[] iPlay
     }
     
     // Validate html tags
-    if (StrContains(sBuffer, "</font>") != -1 || StrContains(sBuffer, "</span>") != -1)
+    if (ToolsIsHintHtml(sBuffer))
     {
-        DataPack hPack = new DataPack();
-        /// Initialize pack
-        hPack.WriteCell(playersNum);
+        // Validate queue
+        if (gServerData.HintQueue == null)
+        {
+            gServerData.HintQueue = new ArrayList(sizeof(HintMessage));
+        }
+
+        /// Initialize message
+        static HintMessage hHint;
+        hHint.Count = playersNum;
         for (int i = 0; i < playersNum; i++)
         {
-            hPack.WriteCell(iPlayers[i]);
+            hHint.Players[i] = iPlayers[i];
         }
-        hPack.WriteString(sBuffer);
-        hPack.Reset();
-        
-        // Execute fix on the next frame
-        RequestFrame(ToolsOnMessageFix, hPack);
+        strcopy(hHint.Text, sizeof(hHint.Text), sBuffer);
+
+        // Validate queue
+        if (!gServerData.HintQueue.Length)
+        {
+            // Execute fix on the next frame
+            RequestFrame(ToolsOnMessageFix);
+        }
+        gServerData.HintQueue.PushArray(hHint, sizeof(hHint));
         
         // Block message
         return Plugin_Handled;
@@ -273,57 +514,86 @@ public Action ToolsOnHintHook(UserMsg hMessage, Protobuf hMsg, const int[] iPlay
 
 /**
  * @brief Called after a default hint message is created.
- *
- * @param hPack             The pack handle.
  **/
-public void ToolsOnMessageFix(DataPack hPack)
+public void ToolsOnMessageFix(/*void*/)
 {
     // Intitialize some variables
-    int iCount = 0; int iCountAll = hPack.ReadCell();
-    static int iPlayers[MAXPLAYERS+1];
+    static HintMessage hHint; static int iPlayers[MAXPLAYERS+1];
     
-    // i = incrementer index 
-    for (int i = 0, client; i < iCountAll; i++)
+    // i = message index
+    int iSize = gServerData.HintQueue.Length;
+    for (int i = 0; i < iSize; i++)
     {
-        /// Extract data from pack
-        client = hPack.ReadCell();
+        // Gets message data
+        gServerData.HintQueue.GetArray(i, hHint, sizeof(hHint));
+
+        // x = incrementer index 
+        int iCount = 0;
+        for (int x = 0; x < hHint.Count; x++)
+        {
+            // Validate client
+            if (IsPlayerExist(hHint.Players[x], false))
+            {
+                iPlayers[iCount++] = hHint.Players[x];
+            }
+        }
         
-        // Validate client
-        if (IsPlayerExist(client, false))
+        // Validate player count
+        if (iCount != 0)
         {
-            iPlayers[iCount++] = client;
+            // Re-send message
+            ToolsPrintHintHtml(iPlayers, iCount, hHint.Text);
+            gServerData.HintResent++;
         }
     }
     
-    // Validate player count
-    if (iCount != 0)
+    // Clear out the queue
+    gServerData.HintQueue.Clear();
+}
+
+/**
+ * @brief Sends the html hint message which is shown without the default frame.
+ *
+ * @note The message is sent with blocked hooks, so it is not re-sent by the hint hook.
+ *
+ * @param iPlayers          Array containing player indexes.
+ * @param playersNum        Number of players in the array.
+ * @param sMessage          The message text.
+ **/
+void ToolsPrintHintHtml(int[] iPlayers, int playersNum, const char[] sMessage)
+{
+    // Create message
+    Protobuf hMessage = view_as<Protobuf>(StartMessageEx(hTextMsg, iPlayers, playersNum, USERMSG_RELIABLE|USERMSG_BLOCKHOOKS));
+    
+    // Validate message
+    if (hMessage != null)
     {
-        // Gets the string from the pack
+        // Initialize text
         static char sBuffer[FILE_LINE_LENGTH];
-        hPack.ReadString(sBuffer, sizeof(sBuffer));
-
-        // Create message
-        Protobuf hMessage = view_as<Protobuf>(StartMessageEx(hTextMsg, iPlayers, iCount, USERMSG_RELIABLE|USERMSG_BLOCKHOOKS));
+        FormatEx(sBuffer, sizeof(sBuffer), "</font>%s%s", sMessage, sEmpty);
         
-        // Validate message
-        if (hMessage != null)
-        {
-            hMessage.SetInt("msg_dst", 4);
-            hMessage.AddString("params", "#SFUI_ContractKillStart");
-            Format(sBuffer, sizeof(sBuffer), "</font>%s%s", sBuffer, sEmpty);
-            hMessage.AddString("params", sBuffer);
-            hMessage.AddString("params", NULL_STRING);
-            hMessage.AddString("params", NULL_STRING);
-            hMessage.AddString("params", NULL_STRING);
-            hMessage.AddString("params", NULL_STRING);
-            
-            // Ends a previously started network message
-            EndMessage();
-        }
+        hMessage.SetInt("msg_dst", 4);
+        hMessage.AddString("params", "#SFUI_ContractKillStart");
+        hMessage.AddString("params", sBuffer);
+        hMessage.AddString("params", NULL_STRING);
+        hMessage.AddString("params", NULL_STRING);
+        hMessage.AddString("params", NULL_STRING);
+        hMessage.AddString("params", NULL_STRING);
+        
+        // Ends a previously started network message
+        EndMessage();
     }
-    
-    // Close pack 
-    delete hPack;
+}
+
+/**
+ * @brief Validates the html tags in the hint message.
+ *
+ * @param sMessage          The message text.
+ * @return                  True if the message contains html, false otherwise.
+ **/
+bool ToolsIsHintHtml(const char[] sMessage)
+{
+    return (StrContains(sMessage, "</font>") != -1 || StrContains(sMessage, "</span>") != -1);
 }
 
 /*
@@ -369,6 +639,123 @@ bool ToolsForceToRespawn(int client)
     return true;
 }
 
+/**
+ * @brief Applies damage, knockback, shake and fade to all players within a sphere.
+ *
+ * @note Shake and fade are sent with one usermessage for all victims.
+ *
+ * @param attacker          The attacker index.
+ * @param inflictor         The inflictor index.
+ * @param vPosition         The sphere origin.
+ * @param flRadius          The sphere radius.
+ * @param iTeam             The victims team, or TEAM_NONE for all.
+ * @param iVictims          The array with victims output.
+ * @param flDamage          The damage at the center.
+ * @param flFalloff         The damage falloff at the edge. (0.0 = none, 1.0 = linear to zero)
+ * @param iBits             The type of damage.
+ * @param flKnockBack       The knockback force at the center.
+ * @param flShakeAmp        The shake amplitude.
+ * @param flShakeFrequency  The shake frequency.
+ * @param flShakeDuration   The shake duration.
+ * @param flFadeDuration    The fade duration.
+ * @param flFadeTime        The fade holding time.
+ * @param vColor            The fade color.
+ * @param iFlags            The fade flags.
+ * @return                  The amount of victims.
+ **/
+int ToolsApplyRadiusEffect(int attacker, int inflictor, float vPosition[3], float flRadius, int iTeam, int[] iVictims, float flDamage, float flFalloff, int iBits, float flKnockBack, float flShakeAmp, float flShakeFrequency, float flShakeDuration, float flFadeDuration, float flFadeTime, int vColor[4], int iFlags)
+{
+    // Initialize vectors
+    static float vEnemy[3]; static float vVelocity[3]; int iCount;
+
+    // Find any players in the radius
+    int i; int it = 1; /// iterator
+    while ((i = AntiStickFindPlayerInSphere(it, vPosition, flRadius)) != -1)
+    {
+        // Validate team
+        if (iTeam != TEAM_NONE && iTeam != (gClientData[i].Zombie ? TEAM_ZOMBIE : TEAM_HUMAN))
+        {
+            continue;
+        }
+        
+        // Store victim
+        iVictims[iCount++] = i;
+        
+        // Gets the distance ratio
+        ToolsGetAbsOrigin(i, vEnemy);
+        float flRatio = GetVectorDistance(vPosition, vEnemy) / flRadius;
+        if (flRatio > 1.0) flRatio = 1.0;
+
+        // Validate knockback
+        if (flKnockBack > 0.0)
+        {
+            // Calculate the velocity vector
+            MakeVectorFromPoints(vPosition, vEnemy, vVelocity);
+            NormalizeVector(vVelocity, vVelocity);
+            ScaleVector(vVelocity, flKnockBack * (1.0 - flRatio));
+
+            // Push the client
+            TeleportEntity(i, NULL_VECTOR, NULL_VECTOR, vVelocity);
+        }
+        
+        // Validate damage
+        if (flDamage > 0.0)
+        {
+            // Apply the damage with falloff
+            HitGroupsTakeDamage(i, attacker, inflictor, flDamage * (1.0 - flFalloff * flRatio), iBits, -1);
+        }
+    }
+    
+    // Validate victims
+    if (!iCount)
+    {
+        return 0;
+    }
+
+    // Validate shake
+    if (flShakeDuration > 0.0)
+    {
+        // Create message
+        Protobuf hShake = view_as<Protobuf>(StartMessage("Shake", iVictims, iCount));
+
+        // Validate message
+        if (hShake != null)
+        {
+            // Write shake information to message handle
+            hShake.SetInt("command", 0);
+            hShake.SetFloat("local_amplitude", flShakeAmp);
+            hShake.SetFloat("frequency", flShakeFrequency);
+            hShake.SetFloat("duration", flShakeDuration);
+
+            // End usermsg and send to the victims
+            EndMessage();
+        }
+    }
+    
+    // Validate fade
+    if (flFadeDuration > 0.0)
+    {
+        // Create message
+        Protobuf hFade = view_as<Protobuf>(StartMessage("Fade", iVictims, iCount));
+
+        // Validate message
+        if (hFade != null)
+        {
+            // Write fade information to message handle
+            hFade.SetInt("duration", RoundToNearest(flFadeDuration * 1000.0)); 
+            hFade.SetInt("hold_time", RoundToNearest(flFadeTime * 1000.0)); 
+            hFade.SetInt("flags", iFlags); 
+            hFade.SetColor("clr", vColor); 
+
+            // End usermsg and send to the victims
+            EndMessage();
+        }
+    }
+    
+    // Return on success
+    return iCount;
+}
+
 /**
  * @brief Gets or sets the velocity of a entity.
  *
@@ -25,6 +25,32 @@
  * ============================================================================
  **/
  
+/**
+ * @section Entity types used by the normal sound hook.
+ **/
+enum SoundEntity
+{
+    SoundEntity_Other,
+    SoundEntity_Melee,
+    SoundEntity_Grenade
+};
+/**
+ * @endsection
+ **/
+ 
+/**
+ * @section Sample types used by the normal sound hook.
+ **/
+enum SoundSample
+{
+    SoundSample_Other,
+    SoundSample_Footstep,
+    SoundSample_Knife
+};
+/**
+ * @endsection
+ **/
+ 
 /**
  * @section Struct of sounds used by the plugin.
  **/
@@ -37,6 +63,15 @@ enum struct SoundData
     int Start;
     int Count;
     int Blast;
+    
+    /* Hook */
+    StringMap Samples;
+    int Hooks;
+    int Overrides;
+    
+    /* Limiter */
+    int Emitted;
+    int Suppressed;
 }
 /**
  * @endsection
@@ -47,6 +82,69 @@ enum struct SoundData
  **/
 SoundData gSoundData;
 
+/**
+ * Array to store entity types, filled once on the entity creation.
+ **/
+SoundEntity gSoundEntity[SOUNDS_ENTITY_MAX];
+
+/**
+ * @brief Player sounds module init function.
+ **/
+void PlayerSoundsOnInit(/*void*/)
+{
+    // Initialize a sample map
+    gSoundData.Samples = new StringMap();
+    
+    // Initialize some chars
+    static char sClassname[SMALL_LINE_LENGTH];
+    
+    // i = entity index (for the late load)
+    int iSize = GetMaxEntities();
+    for (int i = MaxClients + 1; i < iSize && i < SOUNDS_ENTITY_MAX; i++)
+    {
+        // Validate entity
+        if (IsValidEdict(i))
+        {
+            // Gets entity classname
+            GetEdictClassname(i, sClassname, sizeof(sClassname));
+            
+            // Store type
+            PlayerSoundsOnEntityCreated(i, sClassname);
+        }
+    }
+}
+
+/**
+ * @brief Called when an entity is created.
+ *
+ * @param entity            The entity index.
+ * @param sClassname        The string with returned name.
+ **/
+void PlayerSoundsOnEntityCreated(int entity, const char[] sClassname)
+{
+    // Validate networked entity
+    if (entity <= MaxClients || entity >= SOUNDS_ENTITY_MAX)
+    {
+        return;
+    }
+    
+    // Validate melee
+    if (sClassname[0] == 'w' && sClassname[1] == 'e' && sClassname[6] == '_' && // weapon_
+       (sClassname[7] == 'k' || // knife
+       (sClassname[7] == 'm' && sClassname[8] == 'e') ||  // melee
+       (sClassname[7] == 'f' && sClassname[9] == 's'))) // fists
+    {
+        gSoundEntity[entity] = SoundEntity_Melee;
+        return;
+    }
+    
+    // Gets string length
+    int iLen = strlen(sClassname) - 11;
+    
+    // Validate grenade
+    gSoundEntity[entity] = (iLen > 0 && !strncmp(sClassname[iLen], "_proj", 5, false)) ? SoundEntity_Grenade : SoundEntity_Other;
+}
+
 /**
  * @brief Prepare all player sounds data.
  **/
@@ -55,6 +153,9 @@ void PlayerSoundsOnOnLoad(/*void*/)
     // Initialize buffer char
     static char sBuffer[SMALL_LINE_LENGTH];
     
+    // Clear sample types
+    gSoundData.Samples.Clear();
+    
     // Load player flashlight sounds
     gCvarList.SEFFECTS_PLAYER_FLASHLIGHT.GetString(sBuffer, sizeof(sBuffer));
     gSoundData.Flashlight = SoundsKeyToIndex(sBuffer);
@@ -121,7 +222,7 @@ void PlayerSoundsOnCvarInit(/*void*/)
 void PlayerSoundsOnCounterStart(/*void*/)
 {
     // Emit round start sound
-    SEffectsInputEmitToAll(gSoundData.Start, _, SOUND_FROM_PLAYER, SNDCHAN_STATIC, gCvarList.SEFFECTS_LEVEL.IntValue);
+    SEffectsInputEmitToAll(gSoundData.Start, _, SOUND_FROM_PLAYER, SNDCHAN_STATIC, gCvarSnapshot.SoundLevel);
 }
 
 /**
@@ -138,9 +239,9 @@ public Action PlayerSoundsOnRoundEndPost(Handle hTimer, CSRoundEndReason reason)
     switch (reason)
     {
         // Emit sounds
-        case CSRoundEnd_TerroristWin : SEffectsInputEmitToAll(ModesGetSoundEndZombieID(gServerData.RoundMode), _, SOUND_FROM_PLAYER, SNDCHAN_STATIC, gCvarList.SEFFECTS_LEVEL.IntValue);   
-        case CSRoundEnd_CTWin :        SEffectsInputEmitToAll(ModesGetSoundEndHumanID(gServerData.RoundMode), _, SOUND_FROM_PLAYER, SNDCHAN_STATIC, gCvarList.SEFFECTS_LEVEL.IntValue);
-        case CSRoundEnd_Draw :         SEffectsInputEmitToAll(ModesGetSoundEndDrawID(gServerData.RoundMode), _, SOUND_FROM_PLAYER, SNDCHAN_STATIC, gCvarList.SEFFECTS_LEVEL.IntValue);
+        case CSRoundEnd_TerroristWin : SEffectsInputEmitToAll(ModesGetSoundEndZombieID(gServerData.RoundMode), _, SOUND_FROM_PLAYER, SNDCHAN_STATIC, gCvarSnapshot.SoundLevel);   
+        case CSRoundEnd_CTWin :        SEffectsInputEmitToAll(ModesGetSoundEndHumanID(gServerData.RoundMode), _, SOUND_FROM_PLAYER, SNDCHAN_STATIC, gCvarSnapshot.SoundLevel);
+        case CSRoundEnd_Draw :         SEffectsInputEmitToAll(ModesGetSoundEndDrawID(gServerData.RoundMode), _, SOUND_FROM_PLAYER, SNDCHAN_STATIC, gCvarSnapshot.SoundLevel);
     }
     
     // Destroy timer
@@ -155,7 +256,7 @@ public Action PlayerSoundsOnRoundEndPost(Handle hTimer, CSRoundEndReason reason)
 bool PlayerSoundsOnCounter(/*void*/)
 {
     // Emit counter sound
-    return SEffectsInputEmitToAll(gSoundData.Count, gServerData.RoundCount, SOUND_FROM_PLAYER, SNDCHAN_STATIC, gCvarList.SEFFECTS_LEVEL.IntValue);
+    return SEffectsInputEmitToAll(gSoundData.Count, gServerData.RoundCount, SOUND_FROM_PLAYER, SNDCHAN_STATIC, gCvarSnapshot.SoundLevel);
 }
 
 /**
@@ -167,7 +268,7 @@ public Action PlayerSoundsOnBlastPost(Handle hTimer)
     gServerData.BlastTimer = null;
     
     // Emit blast sound
-    SEffectsInputEmitToAll(gSoundData.Blast, _, SOUND_FROM_PLAYER, SNDCHAN_STATIC, gCvarList.SEFFECTS_LEVEL.IntValue);
+    SEffectsInputEmitToAll(gSoundData.Blast, _, SOUND_FROM_PLAYER, SNDCHAN_STATIC, gCvarSnapshot.SoundLevel);
 
     // Destroy timer
     return Plugin_Stop;
@@ -179,7 +280,7 @@ public Action PlayerSoundsOnBlastPost(Handle hTimer)
 void PlayerSoundsOnGameModeStart(/*void*/)
 {
     // Emit round start sound
-    SEffectsInputEmitToAll(ModesGetSoundStartID(gServerData.RoundMode), _, SOUND_FROM_PLAYER, SNDCHAN_STATIC, gCvarList.SEFFECTS_LEVEL.IntValue);
+    SEffectsInputEmitToAll(ModesGetSoundStartID(gServerData.RoundMode), _, SOUND_FROM_PLAYER, SNDCHAN_STATIC, gCvarSnapshot.SoundLevel);
 }
 
 /**
@@ -197,7 +298,7 @@ void PlayerSoundsOnClientDeath(int client)
     }
 
     // Emit death sound
-    SEffectsInputEmitToAll(ClassGetSoundDeathID(gClientData[client].Class), _, client, SNDCHAN_STATIC, gCvarList.SEFFECTS_LEVEL.IntValue);
+    SEffectsInputEmitToAll(ClassGetSoundDeathID(gClientData[client].Class), _, client, SNDCHAN_STATIC, gCvarSnapshot.SoundLevel);
 }
 
 /**
@@ -222,16 +323,16 @@ void PlayerSoundsOnClientHurt(int client, bool bBurning)
         if (bBurning)
         {
             // If burn sounds disabled, then skip
-            if (gCvarList.SEFFECTS_BURN.BoolValue) 
+            if (gCvarSnapshot.SoundBurn) 
             {
                 // Emit burn sound
-                SEffectsInputEmitToAll(ClassGetSoundBurnID(gClientData[client].Class), _, client, SNDCHAN_BODY, gCvarList.SEFFECTS_LEVEL.IntValue);
+                SEffectsInputEmitToAudible(ClassGetSoundBurnID(gClientData[client].Class), _, client, SNDCHAN_BODY, gCvarSnapshot.SoundLevel);
                 return; /// Exit here
             }
         }
         
         // Emit hurt sound
-        SEffectsInputEmitToAll(ClassGetSoundHurtID(gClientData[client].Class), _, client, SNDCHAN_BODY, gCvarList.SEFFECTS_LEVEL.IntValue);
+        SEffectsInputEmitToAudible(ClassGetSoundHurtID(gClientData[client].Class), _, client, SNDCHAN_BODY, gCvarSnapshot.SoundLevel);
     }
 }
 
@@ -250,12 +351,12 @@ void PlayerSoundsOnClientInfected(int client, int attacker)
         if (!attacker)
         {
             // Emit respawn sound
-            SEffectsInputEmitToAll(ClassGetSoundRespawnID(gClientData[client].Class), _, client, SNDCHAN_STATIC, gCvarList.SEFFECTS_LEVEL.IntValue);
+            SEffectsInputEmitToAll(ClassGetSoundRespawnID(gClientData[client].Class), _, client, SNDCHAN_STATIC, gCvarSnapshot.SoundLevel);
         }
         else
         {
             // Emit infect sound
-            SEffectsInputEmitToAll(ClassGetSoundInfectID(gClientData[client].Class), _, client, SNDCHAN_STATIC, gCvarList.SEFFECTS_LEVEL.IntValue);
+            SEffectsInputEmitToAll(ClassGetSoundInfectID(gClientData[client].Class), _, client, SNDCHAN_STATIC, gCvarSnapshot.SoundLevel);
         }
     }
     
@@ -286,7 +387,7 @@ public Action PlayerSoundsOnMoanRepeat(Handle hTimer, int userID)
     if (client)
     {
         // Emit moan sound
-        SEffectsInputEmitToAll(ClassGetSoundIdleID(gClientData[client].Class), _, client, SNDCHAN_STATIC, gCvarList.SEFFECTS_LEVEL.IntValue);
+        SEffectsInputEmitToAudible(ClassGetSoundIdleID(gClientData[client].Class), _, client, SNDCHAN_STATIC, gCvarSnapshot.SoundLevel);
 
         // Allow timer
         return Plugin_Continue;
@@ -307,7 +408,7 @@ public Action PlayerSoundsOnMoanRepeat(Handle hTimer, int userID)
 void PlayerSoundsOnClientRegen(int client)
 {
     // Emit regen sound
-    SEffectsInputEmitToAll(ClassGetSoundRegenID(gClientData[client].Class), _, client, SNDCHAN_STATIC, gCvarList.SEFFECTS_LEVEL.IntValue);
+    SEffectsInputEmitToAll(ClassGetSoundRegenID(gClientData[client].Class), _, client, SNDCHAN_STATIC, gCvarSnapshot.SoundLevel);
 }
 
 /**
@@ -318,7 +419,7 @@ void PlayerSoundsOnClientRegen(int client)
 void PlayerSoundsOnClientJump(int client)
 {
     // Emit jump sound
-    SEffectsInputEmitToAll(ClassGetSoundJumpID(gClientData[client].Class), _, client, SNDCHAN_STATIC, gCvarList.SEFFECTS_LEVEL.IntValue);
+    SEffectsInputEmitToAll(ClassGetSoundJumpID(gClientData[client].Class), _, client, SNDCHAN_STATIC, gCvarSnapshot.SoundLevel);
 }
 
 /**
@@ -329,7 +430,7 @@ void PlayerSoundsOnClientJump(int client)
 void PlayerSoundsOnClientNvgs(int client)
 {
     // Emit player nightvision sound
-    SEffectsInputEmitToAll(gSoundData.Nvgs, _, client, SNDCHAN_ITEM, gCvarList.SEFFECTS_LEVEL.IntValue);
+    SEffectsInputEmitToAll(gSoundData.Nvgs, _, client, SNDCHAN_ITEM, gCvarSnapshot.SoundLevel);
 }
 
 /**
@@ -340,7 +441,7 @@ void PlayerSoundsOnClientNvgs(int client)
 void PlayerSoundsOnClientFlashLight(int client)
 {
     // Emit player flashlight sound
-    SEffectsInputEmitToAll(gSoundData.Flashlight, _, client, SNDCHAN_ITEM, gCvarList.SEFFECTS_LEVEL.IntValue);
+    SEffectsInputEmitToAll(gSoundData.Flashlight, _, client, SNDCHAN_ITEM, gCvarSnapshot.SoundLevel);
 }
 
 /**
@@ -351,7 +452,7 @@ void PlayerSoundsOnClientFlashLight(int client)
 void PlayerSoundsOnClientAmmunition(int client)
 {
     // Emit player ammunition sound
-    SEffectsInputEmitToAll(gSoundData.Ammunition, _, client, SNDCHAN_ITEM, gCvarList.SEFFECTS_LEVEL.IntValue);
+    SEffectsInputEmitToAll(gSoundData.Ammunition, _, client, SNDCHAN_ITEM, gCvarSnapshot.SoundLevel);
 }
 
 /**
@@ -362,7 +463,7 @@ void PlayerSoundsOnClientAmmunition(int client)
 void PlayerSoundsOnClientLevelUp(int client)
 {
     // Emit player levelup sound
-    SEffectsInputEmitToAll(gSoundData.Level, _, client, SNDCHAN_ITEM, gCvarList.SEFFECTS_LEVEL.IntValue);
+    SEffectsInputEmitToAll(gSoundData.Level, _, client, SNDCHAN_ITEM, gCvarSnapshot.SoundLevel);
 }
 
 /**
@@ -375,7 +476,7 @@ void PlayerSoundsOnClientLevelUp(int client)
 bool PlayerSoundsOnClientShoot(int client, int iD)
 {
     // Emit player shoot sound
-    return SEffectsInputEmitToAll(WeaponsGetSoundID(iD), _, client, SNDCHAN_WEAPON, gCvarList.SEFFECTS_LEVEL.IntValue);
+    return SEffectsInputEmitToAll(WeaponsGetSoundID(iD), _, client, SNDCHAN_WEAPON, gCvarSnapshot.SoundLevel);
 }
 
 /**
@@ -393,81 +494,86 @@ bool PlayerSoundsOnClientShoot(int client, int iD)
  **/ 
 public Action PlayerSoundsNormalHook(int clients[MAXPLAYERS-1], int &numClients, char[] sSample, int &entity, int &iChannel, float &flVolume, int &iLevel, int &iPitch, int &iFrags)
 {
-    // Validate entity 
-    if (IsValidEdict(entity))
+    // Increment amount of calls
+    gSoundData.Hooks++;
+    
+    // Validate client
+    if (IsPlayerExist(entity))
     {
-        // Gets entity classname
-        static char sClassname[SMALL_LINE_LENGTH];
-        GetEdictClassname(entity, sClassname, sizeof(sClassname));
-
-        // Validate client
-        if (IsPlayerExist(entity))
+        // If a footstep sounds, then proceed
+        if (PlayerSoundsGetSample(sSample) == SoundSample_Footstep)
         {
-            // If a footstep sounds, then proceed
-            if (StrContains(sSample, "footsteps", false) != -1)
+            // If the client is frozen, then stop
+            if (GetEntityMoveType(entity) == MOVETYPE_NONE)
             {
-                // If the client is frozen, then stop
-                if (GetEntityMoveType(entity) == MOVETYPE_NONE)
+                // Block sounds
+                gSoundData.Overrides++;
+                return Plugin_Stop; 
+            }
+
+            // If footstep sounds disabled, then stop
+            if (gCvarSnapshot.SoundFootsteps) 
+            {
+                // Emit footstep sound
+                if (SEffectsInputEmitToClients(clients, numClients, ClassGetSoundFootID(gClientData[entity].Class), _, entity, SNDCHAN_STREAM, gCvarSnapshot.SoundLevel))
                 {
                     // Block sounds
+                    gSoundData.Overrides++;
                     return Plugin_Stop; 
                 }
-
-                // If footstep sounds disabled, then stop
-                if (gCvarList.SEFFECTS_FOOTSTEPS.BoolValue) 
-                {
-                    // Emit footstep sound
-                    if (SEffectsInputEmitToAll(ClassGetSoundFootID(gClientData[entity].Class), _, entity, SNDCHAN_STREAM, gCvarList.SEFFECTS_LEVEL.IntValue))
-                    {
-                        // Block sounds
-                        return Plugin_Stop; 
-                    }
-                }
             }
         }
-        // Validate melee
-        else if (sClassname[0] == 'w' && sClassname[1] == 'e' && sClassname[6] == '_' && // weapon_
-               (sClassname[7] == 'k' || // knife
-               (sClassname[7] == 'm' && sClassname[8] == 'e') ||  // melee
-               (sClassname[7] == 'f' && sClassname[9] == 's'))) // fists
+        
+        // Allow sounds
+        return Plugin_Continue;
+    }
+    
+    // Validate networked entity
+    if (entity <= MaxClients || entity >= SOUNDS_ENTITY_MAX)
+    {
+        // Allow sounds
+        return Plugin_Continue;
+    }
+    
+    // Gets entity type
+    switch (gSoundEntity[entity])
+    {
+        case SoundEntity_Melee :
         {
             // If a knife sounds, then proceed 
-            if (StrContains(sSample, "knife", false) != -1)
+            if (PlayerSoundsGetSample(sSample) == SoundSample_Knife)
             {
                 // If attack sounds disabled, then stop
-                if (gCvarList.SEFFECTS_CLAWS.BoolValue) 
+                if (gCvarSnapshot.SoundClaws) 
                 {
                     // Validate client
                     int client = ToolsGetOwner(entity);
                     if (IsPlayerExist(client))
                     {
                         // Emit slash sound
-                        if (SEffectsInputEmitToAll(ClassGetSoundAttackID(gClientData[client].Class), _, entity, SNDCHAN_STATIC, gCvarList.SEFFECTS_LEVEL.IntValue))
+                        if (SEffectsInputEmitToClients(clients, numClients, ClassGetSoundAttackID(gClientData[client].Class), _, entity, SNDCHAN_STATIC, gCvarSnapshot.SoundLevel))
                         {
                             // Block sounds
+                            gSoundData.Overrides++;
                             return Plugin_Stop; 
                         }
                     }
                 }
             }
         }
-        else
+        
+        case SoundEntity_Grenade :
         {
-            // Gets string length
-            int iLen = strlen(sClassname) - 11;
+            // Call forward
+            Action hResult;
+            gForwardData._OnGrenadeSound(entity, WeaponsGetCustomID(entity), hResult); 
             
-            // Validate length
-            if (iLen > 0)
+            // Validate result
+            if (hResult != Plugin_Continue)
             {
-                // Validate grenade
-                if (!strncmp(sClassname[iLen], "_proj", 5, false))
-                {
-                    // Call forward
-                    Action hResult;
-                    gForwardData._OnGrenadeSound(entity, WeaponsGetCustomID(entity), hResult); 
-                    return hResult;
-                }
+                gSoundData.Overrides++;
             }
+            return hResult;
         }
     }
 
@@ -475,6 +581,36 @@ public Action PlayerSoundsNormalHook(int clients[MAXPLAYERS-1], int &numClients,
     return Plugin_Continue;
 }
 
+/**
+ * @brief Gets the type of a sample. The result is cached by the sample path.
+ *
+ * @param sSample           The sample path.
+ * @return                  The sample type.
+ **/
+SoundSample PlayerSoundsGetSample(const char[] sSample)
+{
+    // Validate cached type
+    SoundSample iType;
+    if (!gSoundData.Samples.GetValue(sSample, iType))
+    {
+        // Find the type
+        if (StrContains(sSample, "footsteps", false) != -1)
+        {
+            iType = SoundSample_Footstep;
+        }
+        else if (StrContains(sSample, "knife", false) != -1)
+        {
+            iType = SoundSample_Knife;
+        }
+        
+        // Store type
+        gSoundData.Samples.SetValue(sSample, iType);
+    }
+    
+    // Return type
+    return iType;
+}
+
 /**
  * Cvar hook callback (zp_seffects_player_*, zp_seffects_round_*)
  * @brief Load the sound variables.
@@ -25,6 +25,54 @@
  * ============================================================================
  **/
 
+/**
+ * @section Audibility policies of the emitted sounds.
+ **/
+enum SoundRange
+{
+    SoundRange_All,               /** Sends to every client on the server. */
+    SoundRange_Audible,           /** Sends to clients which are in the PAS of the sound origin. */
+    SoundRange_Clients            /** Sends to the given list of clients. (For an example: recipients of a hooked sound) */
+};
+/**
+ * @endsection
+ **/
+
+/**
+ * @section Number of the rate limiter slots per entity.
+ **/
+#define SOUNDS_RATE_SLOTS 4
+/**
+ * @endsection
+ **/
+ 
+/**
+ * Arrays to store the last emissions of the entity. (key and channel, time)
+ **/
+int gSoundRateKey[SOUNDS_ENTITY_MAX][SOUNDS_RATE_SLOTS];
+float gSoundRateTime[SOUNDS_ENTITY_MAX][SOUNDS_RATE_SLOTS];
+
+/**
+ * @brief Clears the rate limiter slots of the destroyed entity.
+ *
+ * @param entity            The entity index.
+ **/
+void SEffectsOnEntityDestroyed(int entity)
+{
+    // Validate entity (world slot is shared)
+    if (entity <= 0 || entity >= SOUNDS_ENTITY_MAX)
+    {
+        return;
+    }
+    
+    // i = slot index
+    for (int i = 0; i < SOUNDS_RATE_SLOTS; i++)
+    {
+        gSoundRateKey[entity][i] = 0;
+        gSoundRateTime[entity][i] = 0.0;
+    }
+}
+
 /**
  * @brief Emits a sound to all clients.
  *
@@ -44,6 +92,76 @@
  * @return                  True if the sound was emitted, false otherwise.
  **/
 bool SEffectsInputEmitToAll(int iKey, int iNum = 0, int entity = SOUND_FROM_PLAYER, int iChannel = SNDCHAN_AUTO, int iLevel = SNDLEVEL_NORMAL, int iFlags = SND_NOFLAGS, float flVolume = SNDVOL_NORMAL, int iPitch = SNDPITCH_NORMAL, int speaker = -1, float vPosition[3] = NULL_VECTOR, float vDirection[3] = NULL_VECTOR, bool updatePos = true, float flSoundTime = 0.0)
+{
+    // Emit sound to everyone
+    static int clients[MAXPLAYERS+1];
+    return SEffectsInputEmit(SoundRange_All, clients, 0, iKey, iNum, entity, iChannel, iLevel, iFlags, flVolume, iPitch, speaker, vPosition, vDirection, updatePos, flSoundTime);
+}
+
+/**
+ * @brief Emits a sound to clients which can hear the origin.
+ *
+ * @param iKey              The key array.
+ * @param iNum              (Optional) The position index. (for not random sound)
+ * @param entity            (Optional) The entity to emit from.
+ * @param iChannel          (Optional) The channel to emit with.
+ * @param iLevel            (Optional) The sound level.
+ * @param iFlags            (Optional) The sound flags.
+ * @param flVolume          (Optional) The sound volume.
+ * @param iPitch            (Optional) The sound pitch.
+ * @return                  True if the sound was emitted, false otherwise.
+ **/
+bool SEffectsInputEmitToAudible(int iKey, int iNum = 0, int entity = SOUND_FROM_PLAYER, int iChannel = SNDCHAN_AUTO, int iLevel = SNDLEVEL_NORMAL, int iFlags = SND_NOFLAGS, float flVolume = SNDVOL_NORMAL, int iPitch = SNDPITCH_NORMAL)
+{
+    // Emit sound to the PAS
+    static int clients[MAXPLAYERS+1];
+    return SEffectsInputEmit(SoundRange_Audible, clients, 0, iKey, iNum, entity, iChannel, iLevel, iFlags, flVolume, iPitch);
+}
+
+/**
+ * @brief Emits a sound to the given clients.
+ *
+ * @param clients           The array of clients.
+ * @param numClients        The number of clients in the array.
+ * @param iKey              The key array.
+ * @param iNum              (Optional) The position index. (for not random sound)
+ * @param entity            (Optional) The entity to emit from.
+ * @param iChannel          (Optional) The channel to emit with.
+ * @param iLevel            (Optional) The sound level.
+ * @param iFlags            (Optional) The sound flags.
+ * @param flVolume          (Optional) The sound volume.
+ * @param iPitch            (Optional) The sound pitch.
+ * @return                  True if the sound was emitted, false otherwise.
+ **/
+bool SEffectsInputEmitToClients(int[] clients, int numClients, int iKey, int iNum = 0, int entity = SOUND_FROM_PLAYER, int iChannel = SNDCHAN_AUTO, int iLevel = SNDLEVEL_NORMAL, int iFlags = SND_NOFLAGS, float flVolume = SNDVOL_NORMAL, int iPitch = SNDPITCH_NORMAL)
+{
+    // Emit sound to the list
+    return SEffectsInputEmit(SoundRange_Clients, clients, numClients, iKey, iNum, entity, iChannel, iLevel, iFlags, flVolume, iPitch);
+}
+
+/**
+ * @brief Emits a sound to clients selected by the audibility policy. 
+ *        The maximum distance of the key is applied to every policy, when the sound has an origin.
+ *
+ * @param iRange            The audibility policy.
+ * @param clients           The array of clients. (Used only by SoundRange_Clients)
+ * @param numClients        The number of clients in the array.
+ * @param iKey              The key array.
+ * @param iNum              (Optional) The position index. (for not random sound)
+ * @param entity            (Optional) The entity to emit from.
+ * @param iChannel          (Optional) The channel to emit with.
+ * @param iLevel            (Optional) The sound level.
+ * @param iFlags            (Optional) The sound flags.
+ * @param flVolume          (Optional) The sound volume.
+ * @param iPitch            (Optional) The sound pitch.
+ * @param speaker           (Optional) Unknown.
+ * @param vPosition         (Optional) The sound origin.
+ * @param vDirection        (Optional) The sound direction.
+ * @param updatePos         (Optional) Unknown (update positions?)
+ * @param flSoundTime       (Optional) Alternate time to play sound for.
+ * @return                  True if the sound was emitted, false otherwise.
+ **/
+bool SEffectsInputEmit(SoundRange iRange, int[] clients, int numClients, int iKey, int iNum = 0, int entity = SOUND_FROM_PLAYER, int iChannel = SNDCHAN_AUTO, int iLevel = SNDLEVEL_NORMAL, int iFlags = SND_NOFLAGS, float flVolume = SNDVOL_NORMAL, int iPitch = SNDPITCH_NORMAL, int speaker = -1, float vPosition[3] = NULL_VECTOR, float vDirection[3] = NULL_VECTOR, bool updatePos = true, float flSoundTime = 0.0)
 {
     // Initialize sound char
     static char sSound[PLATFORM_LINE_LENGTH]; sSound[0] = NULL_STRING[0];
@@ -54,11 +172,73 @@ bool SEffectsInputEmitToAll(int iKey, int iNum = 0, int entity = SOUND_FROM_PLAY
     // Validate sound
     if (hasLength(sSound))
     {
+        // Drop duplicates emitted within the interval of the key
+        if (!SEffectsCheckRate(iKey, entity, iChannel))
+        {
+            gSoundData.Suppressed++;
+            return true;
+        }
+        gSoundData.Emitted++;
+        
         // Format sound
         Format(sSound, sizeof(sSound), "*/%s", sSound);
 
+        // Gets the sound origin
+        static float vOrigin[3]; bool bOrigin = SEffectsGetOrigin(entity, vPosition, vOrigin);
+        
+        // Gets recipients
+        static int iRecipients[MAXPLAYERS+1]; int iCount;
+        if (iRange == SoundRange_Clients)
+        {
+            // Gets the emitting player (weapons emit on behalf of the owner)
+            int emitter = entity;
+            if (entity > MaxClients && IsValidEdict(entity))
+            {
+                emitter = ToolsGetOwner(entity);
+            }
+
+            // i = client index
+            bool bSelf = !IsPlayerExist(emitter, false);
+            for (int i = 0; i < numClients; i++)
+            {
+                iRecipients[iCount++] = clients[i];
+                if (clients[i] == emitter) bSelf = true;
+            }
+
+            // Predicted sounds are not sent to the emitter by the engine, but the replaced one should be
+            if (!bSelf) iRecipients[iCount++] = emitter;
+        }
+        else if (iRange == SoundRange_Audible && bOrigin)
+        {
+            // Gets clients in the PAS
+            iCount = GetClientsInRange(vOrigin, RangeType_Audibility, iRecipients, MaxClients);
+        }
+        else
+        {
+            // i = client index
+            for (int i = 1; i <= MaxClients; i++)
+            {
+                // Validate client
+                if (IsClientInGame(i))
+                {
+                    iRecipients[iCount++] = i;
+                }
+            }
+        }
+        
+        // Validate distance
+        float flDistance = SoundsGetDistance(iKey);
+        if (bOrigin && flDistance > 0.0)
+        {
+            // Cut the clients which are too far away
+            iCount = SEffectsFilterDistance(iRecipients, iCount, entity, vOrigin, flDistance);
+        }
+
         // Emit sound
-        EmitSoundToAll(sSound, entity, iChannel, iLevel, iFlags, flVolume, iPitch, speaker, vPosition, vDirection, updatePos, flSoundTime);
+        if (iCount)
+        {
+            EmitSound(iRecipients, iCount, sSound, entity, iChannel, iLevel, iFlags, flVolume, iPitch, speaker, vPosition, vDirection, updatePos, flSoundTime);
+        }
         return true;
     }
 
@@ -66,6 +246,123 @@ bool SEffectsInputEmitToAll(int iKey, int iNum = 0, int entity = SOUND_FROM_PLAY
     return false;
 }
 
+/**
+ * @brief Checks the interval between emissions of the same key from the entity on the channel, and stores the emission.
+ *
+ * @param iKey              The key array.
+ * @param entity            The entity to emit from.
+ * @param iChannel          The channel to emit with.
+ * @return                  True if the sound can be emitted, false if it is a duplicate.
+ **/
+bool SEffectsCheckRate(int iKey, int entity, int iChannel)
+{
+    // Validate interval
+    float flInterval = SoundsGetInterval(iKey);
+    if (flInterval <= 0.0)
+    {
+        return true;
+    }
+    
+    // Global sounds share the world slot
+    if (entity <= 0 || entity >= SOUNDS_ENTITY_MAX)
+    {
+        entity = 0;
+    }
+    
+    // Initialize variables
+    float flCurrentTime = GetGameTime(); int iHash = ((iKey + 1) << 8) | (iChannel & 0xFF); int iSlot; 
+    
+    // i = slot index
+    for (int i = 0; i < SOUNDS_RATE_SLOTS; i++)
+    {
+        // Validate same key and channel
+        if (gSoundRateKey[entity][i] == iHash)
+        {
+            // Validate interval
+            if (flCurrentTime - gSoundRateTime[entity][i] < flInterval && flCurrentTime >= gSoundRateTime[entity][i])
+            {
+                return false;
+            }
+            
+            iSlot = i;
+            break;
+        }
+        
+        // Find the oldest slot
+        if (gSoundRateTime[entity][i] < gSoundRateTime[entity][iSlot])
+        {
+            iSlot = i;
+        }
+    }
+    
+    // Store emission
+    gSoundRateKey[entity][iSlot] = iHash;
+    gSoundRateTime[entity][iSlot] = flCurrentTime;
+    return true;
+}
+
+/**
+ * @brief Gets the origin of the emitted sound.
+ *
+ * @param entity            The entity to emit from.
+ * @param vPosition         The sound origin.
+ * @param vOrigin           The vector to return origin in.
+ * @return                  True if the sound has an origin, false otherwise.
+ **/
+bool SEffectsGetOrigin(int entity, float vPosition[3], float vOrigin[3])
+{
+    // Validate position
+    if (!IsNullVector(vPosition))
+    {
+        vOrigin = vPosition;
+        return true;
+    }
+    
+    // Validate entity
+    if (entity > 0 && IsValidEdict(entity))
+    {
+        // Gets entity position
+        GetEntPropVector(entity, Prop_Data, "m_vecAbsOrigin", vOrigin);
+        return true;
+    }
+    
+    // Global sound
+    return false;
+}
+
+/**
+ * @brief Removes clients which are further than the distance from the list.
+ *
+ * @param clients           The array of clients.
+ * @param numClients        The number of clients in the array.
+ * @param entity            The entity to emit from. (Always kept)
+ * @param vOrigin           The sound origin.
+ * @param flDistance        The maximum distance.
+ * @return                  The new number of clients in the array.
+ **/
+int SEffectsFilterDistance(int[] clients, int numClients, int entity, float vOrigin[3], float flDistance)
+{
+    // Initialize variables
+    static float vPosition[3]; int iCount; flDistance *= flDistance;
+    
+    // i = client index
+    for (int i = 0; i < numClients; i++)
+    {
+        // Gets client position
+        int client = clients[i];
+        GetClientAbsOrigin(client, vPosition);
+        
+        // Validate distance
+        if (client == entity || GetVectorDistance(vOrigin, vPosition, true) <= flDistance)
+        {
+            clients[iCount++] = client;
+        }
+    }
+    
+    // Return amount
+    return iCount;
+}
+
 /**
  * @brief Emits a sound to the client.
  *
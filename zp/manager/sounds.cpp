@@ -37,23 +37,55 @@ enum
  * @endsection
  **/
  
+/**
+ * @section Max amount of networked entities.
+ **/
+#define SOUNDS_ENTITY_MAX 2048
+/**
+ * @endsection
+ **/
+ 
+/**
+ * @section Struct of sound block options, set in the key. (KEY{distance:1000, interval:0.2} = "...")
+ **/
+enum struct SoundLimit
+{
+    float Distance;
+    float Interval;
+}
+/**
+ * @endsection
+ **/
+ 
 /*
  * Load other sound effect modules
  */
 #include "zp/manager/soundeffects/voice.cpp"
 #include "zp/manager/soundeffects/ambientsounds.cpp"
-#include "zp/manager/soundeffects/soundeffects.cpp"
 #include "zp/manager/soundeffects/playersounds.cpp"
+#include "zp/manager/soundeffects/soundeffects.cpp"
 
 /**
  * @brief Sounds module init function.
  **/
 void SoundsOnInit(/*void*/)
 {
+    // Forward event to sub-modules
+    PlayerSoundsOnInit();
+    
     // Hooks server sounds
     AddNormalSoundHook(view_as<NormalSHook>(PlayerSoundsNormalHook));
 }
 
+/**
+ * @brief Creates commands for sounds module.
+ **/
+void SoundsOnCommandInit(/*void*/)
+{
+    // Hook commands
+    RegAdminCmd("zp_sound_stats", SoundsStatsOnCommandCatched, ADMFLAG_CONFIG, "Prints the sound hook statistics.");
+}
+
 /**
  * @brief Prepare all sound data.
  **/
@@ -124,6 +156,18 @@ void SoundsOnCacheData(/*void*/)
         return;
     }
     
+    // Validate limits array
+    if (gServerData.SoundLimits == null)
+    {
+        // Initialize a limits array
+        gServerData.SoundLimits = new ArrayList(sizeof(SoundLimit));
+    }
+    else
+    {
+        // Clear out the array of all data
+        gServerData.SoundLimits.Clear();
+    }
+    
     // i = sound array index
     for (int i = 0; i < iSounds; i++)
     {
@@ -133,6 +177,9 @@ void SoundsOnCacheData(/*void*/)
         // Parses a parameter string in key="value" format
         if (ParamParseString(arraySound, sPathSounds, sizeof(sPathSounds), '=') == PARAM_ERROR_NO)
         {
+            // Parses and strips the block options from the key
+            SoundsOnCacheLimit(arraySound);
+            
             // i = block index
             int iSize = arraySound.Length;
             for (int x = 1; x < iSize; x++)
@@ -167,6 +214,64 @@ void SoundsOnCacheData(/*void*/)
     LogEvent(true, LogType_Normal, LOG_DEBUG_DETAIL, LogModule_Sounds, "Config Validation", "Total blocks: \"%d\" | Unsuccessful blocks: \"%d\" | Total: %d | Successful: \"%d\" | Unsuccessful: \"%d\"", iSoundCount, iSoundCount - iSounds, iSoundValidCount + iSoundUnValidCount, iSoundValidCount, iSoundUnValidCount);
 }
 
+/**
+ * @brief Parses the block options from the sound key. (KEY{distance:1000, interval:0.2})
+ *
+ * @param arraySound        The array handle of the sound block.
+ **/
+void SoundsOnCacheLimit(ArrayList arraySound)
+{
+    // Initialize some variables
+    static char sKey[PLATFORM_LINE_LENGTH]; static char sOptions[PLATFORM_LINE_LENGTH];
+    static char sOption[SMALL_LINE_LENGTH][SMALL_LINE_LENGTH]; static char sValue[2][SMALL_LINE_LENGTH];
+    SoundLimit limit;
+    
+    // Gets sound key
+    arraySound.GetString(SOUNDS_DATA_KEY, sKey, sizeof(sKey));
+    
+    // Validate options
+    int iPos = FindCharInString(sKey, '{');
+    if (iPos != -1)
+    {
+        // Extract options string
+        int iEnd = FindCharInString(sKey, '}', true);
+        StrExtract(sOptions, sKey, iPos + 1, (iEnd > iPos) ? iEnd : strlen(sKey));
+        
+        // Cut options out of the key
+        sKey[iPos] = NULL_STRING[0]; TrimString(sKey);
+        arraySound.SetString(SOUNDS_DATA_KEY, sKey);
+        
+        // i = option index
+        int iAmount = ExplodeString(sOptions, ",", sOption, sizeof(sOption), sizeof(sOption[]));
+        for (int i = 0; i < iAmount; i++)
+        {
+            // Splits option into name and value
+            if (ExplodeString(sOption[i], ":", sValue, sizeof(sValue), sizeof(sValue[])) != 2)
+            {
+                continue;
+            }
+            TrimString(sValue[0]); TrimString(sValue[1]);
+            
+            // Validate option
+            if (!strcmp(sValue[0], "distance", false))
+            {
+                limit.Distance = StringToFloat(sValue[1]);
+            }
+            else if (!strcmp(sValue[0], "interval", false))
+            {
+                limit.Interval = StringToFloat(sValue[1]);
+            }
+            else
+            {
+                LogEvent(false, LogType_Error, LOG_GAME_EVENTS, LogModule_Sounds, "Config Validation", "Unknown option \"%s\" in sound block: \"%s\"", sValue[0], sKey);
+            }
+        }
+    }
+    
+    // Push data into array
+    gServerData.SoundLimits.PushArray(limit);
+}
+
 /**
  * @brief Called when configs are being reloaded.
  **/
@@ -193,6 +298,59 @@ void SoundsOnCvarInit(/*void*/)
  * Sounds main functions.
  */
 
+/**
+ * @brief Called when an entity is created.
+ *
+ * @param entity            The entity index.
+ * @param sClassname        The string with returned name.
+ **/
+void SoundsOnEntityCreated(int entity, const char[] sClassname)
+{
+    // Forward event to sub-modules
+    PlayerSoundsOnEntityCreated(entity, sClassname);
+}
+
+/**
+ * @brief Called when an entity is destroyed.
+ *
+ * @param entity            The entity index.
+ **/
+void SoundsOnEntityDestroyed(int entity)
+{
+    // Forward event to sub-modules
+    SEffectsOnEntityDestroyed(entity);
+}
+
+/**
+ * Console command callback (zp_sound_stats)
+ * @brief Prints the sound hook statistics.
+ * 
+ * @param client            The client index.
+ * @param iArguments        The number of arguments that were in the argument string.
+ **/ 
+public Action SoundsStatsOnCommandCatched(int client, int iArguments)
+{
+    // Initialize variables
+    static char sBuffer[HUGE_LINE_LENGTH]; sBuffer[0] = NULL_STRING[0];
+    static char sLine[BIG_LINE_LENGTH];
+
+    // Format strings
+    FormatEx(sLine, sizeof(sLine), "%24s: %d\n", "Hook calls", gSoundData.Hooks);
+    StrCat(sBuffer, sizeof(sBuffer), sLine);
+    FormatEx(sLine, sizeof(sLine), "%24s: %d\n", "Hook overrides", gSoundData.Overrides);
+    StrCat(sBuffer, sizeof(sBuffer), sLine);
+    FormatEx(sLine, sizeof(sLine), "%24s: %d\n", "Cached samples", gSoundData.Samples.Size);
+    StrCat(sBuffer, sizeof(sBuffer), sLine);
+    FormatEx(sLine, sizeof(sLine), "%24s: %d\n", "Emitted sounds", gSoundData.Emitted);
+    StrCat(sBuffer, sizeof(sBuffer), sLine);
+    FormatEx(sLine, sizeof(sLine), "%24s: %d\n", "Suppressed sounds", gSoundData.Suppressed);
+    StrCat(sBuffer, sizeof(sBuffer), sLine);
+    
+    // Send information into the console
+    ReplyToCommand(client, sBuffer);
+    return Plugin_Handled;
+}
+
 /**
  * @brief The round is starting.
  **/
@@ -552,6 +710,50 @@ void SoundsGetPath(int iKey, char[] sPath, int iMaxLen, int iNum = 0)
     }
 }
 
+/**
+ * @brief Gets the maximum audible distance of a sound list at a given key.
+ * 
+ * @param iKey              The sound array index.
+ * @return                  The distance, or 0.0 if unlimited.
+ **/
+float SoundsGetDistance(int iKey)
+{
+    // Validate key
+    if (iKey == -1)
+    {
+        return 0.0;
+    }
+    
+    // Gets options at given index
+    SoundLimit limit;
+    gServerData.SoundLimits.GetArray(iKey, limit);
+    
+    // Return distance
+    return limit.Distance;
+}
+
+/**
+ * @brief Gets the minimum interval between emissions of a sound list at a given key from the same entity and channel.
+ * 
+ * @param iKey              The sound array index.
+ * @return                  The interval, or 0.0 if unlimited.
+ **/
+float SoundsGetInterval(int iKey)
+{
+    // Validate key
+    if (iKey == -1)
+    {
+        return 0.0;
+    }
+    
+    // Gets options at given index
+    SoundLimit limit;
+    gServerData.SoundLimits.GetArray(iKey, limit);
+    
+    // Return interval
+    return limit.Interval;
+}
+
 /**
  * @brief Stops a sound list at a given key.
  * 
@@ -25,6 +25,19 @@
  * ============================================================================
  **/
 
+/**
+ * @section Health sprite manager.
+ **/
+#define HEALTH_SPRITE_INTERVAL 0.1
+/**
+ * @endsection
+ **/
+
+/**
+ * Arrays to store the active sprites and their last sent frames.
+ **/
+int gHealthList[MAXPLAYERS+1]; int gHealthCount; bool gHealthActive[MAXPLAYERS+1]; bool gHealthVisible[MAXPLAYERS+1]; int gHealthFrame[MAXPLAYERS+1];
+
 /**
  * @brief Health module load function.
  **/         
@@ -206,85 +219,102 @@ void HealthOnClientHurt(int client, int attacker, int iHealth)
         }
         
         // Make it visible
-        AcceptEntityInput(entity, "ShowSprite");
+        if (!gHealthVisible[attacker])
+        {
+            AcceptEntityInput(entity, "ShowSprite");
+            gHealthVisible[attacker] = true;
+        }
         
         // Calculate frame and update sprite
         HealthShowSprite(attacker, HealthGetFrame(client));
         
-        // Sets timer for updating sprite
+        // Sets duration for updating sprite
         gClientData[attacker].HealthDuration = gCvarList.VEFFECTS_HEALTH_DURATION.FloatValue;
-        delete gClientData[attacker].SpriteTimer;
-        gClientData[attacker].SpriteTimer = CreateTimer(0.1, HealthOnClientSprite, GetClientUserId(attacker), TIMER_REPEAT | TIMER_FLAG_NO_MAPCHANGE);
+        HealthActivateSprite(attacker);
     }
 }
 
 /**
- * @brief Timer callback, update a player sprite with health.
+ * @brief Timer callback, update all active sprites with health.
  *
  * @param hTimer            The timer handle.
- * @param userID            The user id.
  **/
-public Action HealthOnClientSprite(Handle hTimer, int userID)
+public Action HealthOnSpriteUpdate(Handle hTimer)
 {
-    // Gets client index from the user ID
-    int client = GetClientOfUserId(userID);
+    // Gets frames amount once per tick
+    float flMaxFrames = gCvarList.VEFFECTS_HEALTH_FRAMES.FloatValue - 1.0;
 
-    // Validate client
-    if (client)
+    // i = sprite index
+    for (int i = gHealthCount - 1; i >= 0; i--)
     {
-        // Gets current sprite from the client reference
-        int entity = EntRefToEntIndex(gClientData[client].AttachmentHealth);
-        
-        // Validate sprite
-        if (entity != -1) 
+        // Update sprite
+        int client = gHealthList[i];
+        if (!HealthOnSpriteThink(client, flMaxFrames))
         {
-            // If duration is over, then stop
-            if (gClientData[client].HealthDuration <= 0.0)
-            {
-                // Make it invisible
-                AcceptEntityInput(entity, "HideSprite");  
-        
-                // Clear timer
-                gClientData[client].SpriteTimer = null;
-                
-                // Destroy timer
-                return Plugin_Stop;
-            }
-            
-            // Substitute counter
-            gClientData[client].HealthDuration -= 0.1;
-            
-            // Gets victim index
-            userID = GetClientOfUserId(gClientData[client].LastAttacker);
-            if (userID)
-            {
-                // Validate invisibility
-                if (UTIL_GetRenderColor(userID, Color_Alpha) <= 0)
-                {
-                    // Make it invisible
-                    AcceptEntityInput(entity, "HideSprite");  
-            
-                    // Clear timer
-                    gClientData[client].SpriteTimer = null;
-                    
-                    // Destroy timer
-                    return Plugin_Stop;
-                }
-        
-                // Calculate frame and update sprite
-                HealthShowSprite(client, HealthGetFrame(userID));
-
-                // Allow timer
-                return Plugin_Continue;
-            }
+            // Remove sprite from the list
+            gHealthActive[client] = false;
+            gHealthList[i] = gHealthList[--gHealthCount];
         }
     }
+    
+    // If there are no sprites, then stop
+    if (!gHealthCount)
+    {
+        // Clear timer
+        gServerData.HealthTimer = null;
+        
+        // Destroy timer
+        return Plugin_Stop;
+    }
+    
+    // Allow timer
+    return Plugin_Continue;
+}
 
-    // Clear timer
-    gClientData[client].SpriteTimer = null;
+/**
+ * @brief Update a player sprite with health.
+ *
+ * @param client            The client index.
+ * @param flMaxFrames       The last frame index.
+ * @return                  True to keep sprite active, false otherwise.
+ **/
+bool HealthOnSpriteThink(int client, float flMaxFrames)
+{
+    // Validate sprite
+    if (!gHealthVisible[client] || EntRefToEntIndex(gClientData[client].AttachmentHealth) == -1) 
+    {
+        return false;
+    }
     
-    // Destroy timer
-    return Plugin_Stop;
+    // If duration is over, then stop
+    if (gClientData[client].HealthDuration <= 0.0)
+    {
+        // Make it invisible
+        HealthHideSprite(client);
+        return false;
+    }
+    
+    // Substitute counter
+    gClientData[client].HealthDuration -= HEALTH_SPRITE_INTERVAL;
+    
+    // Gets victim index
+    int victim = GetClientOfUserId(gClientData[client].LastAttacker);
+    if (!victim)
+    {
+        return false;
+    }
+    
+    // Validate invisibility
+    if (UTIL_GetRenderColor(victim, Color_Alpha) <= 0)
+    {
+        // Make it invisible
+        HealthHideSprite(client);
+        return false;
+    }
+
+    // Calculate frame and update sprite
+    HealthShowSprite(client, HealthGetFrame(victim, flMaxFrames));
+    return true;
 }
  
 /*
@@ -328,6 +358,10 @@ bool HealthCreateSprite(int client)
         // Hook entity callbacks
         SDKHook(entity, SDKHook_SetTransmit, HealthOnTransmit);
 
+        // Resets sprite cache
+        gHealthVisible[client] = false;
+        gHealthFrame[client] = -1;
+
         // Store the client cache
         gClientData[client].AttachmentHealth = EntIndexToEntRef(entity);
     }
@@ -349,6 +383,28 @@ bool HealthCreateSprite(int client)
     return true;
 }
 
+/**
+ * @brief Adds the health sprite of the client to the update list.
+ *
+ * @param client            The client index.
+ **/ 
+void HealthActivateSprite(int client)
+{
+    // Validate sprite
+    if (!gHealthActive[client])
+    {
+        // Push sprite into the list
+        gHealthList[gHealthCount++] = client;
+        gHealthActive[client] = true;
+    }
+    
+    // If timer hasn't been created, then create
+    if (gServerData.HealthTimer == null)
+    {
+        gServerData.HealthTimer = CreateTimer(HEALTH_SPRITE_INTERVAL, HealthOnSpriteUpdate, _, TIMER_REPEAT | TIMER_FLAG_NO_MAPCHANGE);
+    }
+}
+
 /**
  * @brief Hide the health sprite to all attackers.
  *
@@ -375,9 +431,18 @@ void HealthHideAllSprites(int client)
  **/ 
 void HealthHideSprite(int client)
 {
+    // Validate visibility
+    if (!gHealthVisible[client])
+    {
+        return;
+    }
+    
     // Gets current sprite from the client reference
     int entity = EntRefToEntIndex(gClientData[client].AttachmentHealth);
     if (entity != -1) AcceptEntityInput(entity, "HideSprite");
+    
+    // Update sprite cache
+    gHealthVisible[client] = false;
 }
 
 /**
@@ -388,6 +453,12 @@ void HealthHideSprite(int client)
  **/ 
 void HealthShowSprite(int client, int iFrame)
 {
+    // If frame is already sent, then skip
+    if (gHealthFrame[client] == iFrame)
+    {
+        return;
+    }
+    
     // Gets current controller from the client reference
     int entity = EntRefToEntIndex(gClientData[client].AttachmentController);
 
@@ -401,6 +472,9 @@ void HealthShowSprite(int client, int iFrame)
         // Sets modified flags on the entity
         SetVariantString(sFrame);
         AcceptEntityInput(entity, "StartAnimSequence");
+        
+        // Store the frame cache
+        gHealthFrame[client] = iFrame;
     }
 }
 
@@ -408,11 +482,12 @@ void HealthShowSprite(int client, int iFrame)
  * @brief Gets the frame index.
  *
  * @param client            The client index.
+ * @param flMaxFrames       (Optional) The last frame index, read from the cvar if not set.
  **/ 
-int HealthGetFrame(int client)
+int HealthGetFrame(int client, float flMaxFrames = 0.0)
 {
     // Calculate the frames
-    float flMaxFrames = gCvarList.VEFFECTS_HEALTH_FRAMES.FloatValue - 1.0;
+    if (!flMaxFrames) flMaxFrames = gCvarList.VEFFECTS_HEALTH_FRAMES.FloatValue - 1.0;
     float flFrame = float(ToolsGetHealth(client)) / float(ClassGetHealth(gClientData[client].Class)) * flMaxFrames;
 
     // Return the frame position
@@ -66,9 +66,7 @@ enum
     WEAPONS_DATA_MODEL_SKIN,
     WEAPONS_DATA_MODEL_MUZZLE,
     WEAPONS_DATA_MODEL_SHELL,
-    WEAPONS_DATA_MODEL_HEAT,
-    WEAPONS_DATA_SEQUENCE_COUNT,
-    WEAPONS_DATA_SEQUENCE_SWAP
+    WEAPONS_DATA_MODEL_HEAT
 };
 /**
  * @endsection
@@ -80,6 +78,7 @@ enum
 #include "zp/manager/weapons/weaponmod.cpp"
 #include "zp/manager/weapons/weaponhdr.cpp"
 #include "zp/manager/weapons/weaponattach.cpp"
+#include "zp/manager/weapons/weaponindex.cpp"
 #include "zp/manager/weapons/zmarket.cpp"
 
 /**
@@ -143,6 +142,7 @@ void WeaponsOnLoad(/*void*/)
     
     // Forward event to sub-modules
     WeaponMODOnLoad();
+    WeaponHDROnLoad();
 }
 
 /**
@@ -177,6 +177,9 @@ void WeaponsOnCacheData(/*void*/)
         gServerData.Entities.Clear();
     }
     
+    // Clear out the menu templates
+    MenusClearTemplates();
+    
     // Validate size
     int iSize = gServerData.Weapons.Length;
     if (!iSize)
@@ -185,6 +188,9 @@ void WeaponsOnCacheData(/*void*/)
         return;
     }
     
+    // Creates buy limit table
+    WeaponsCreateLimits(iSize);
+    
     // On windows/mac this is actually ItemSystem() + sizeof(void *) is ItemSchema
     Address pItemSchema = (gServerData.Platform == OS_Linux) ? view_as<Address>(SDKCall(hSDKCallGetItemSchema)) : view_as<Address>(SDKCall(hSDKCallGetItemSchema) + 4);
     
@@ -278,8 +284,6 @@ void WeaponsOnCacheData(/*void*/)
         kvWeapons.GetString("shell", sPathWeapons, sizeof(sPathWeapons), "");
         arrayWeapon.PushString(sPathWeapons);                                 // Index: 30
         arrayWeapon.Push(kvWeapons.GetFloat("heat", 0.5));                    // Index: 31
-        arrayWeapon.Push(-1); int iSeq[WEAPONS_SEQUENCE_MAX];                 // Index: 32
-        arrayWeapon.PushArray(iSeq, sizeof(iSeq));                            // Index: 33
     }
 
     // We're done with this file now, so we can close it
@@ -313,6 +317,7 @@ void WeaponsOnCommandInit(/*void*/)
     // Forward event to sub-modules
     ZMarketOnCommandInit();
     WeaponMODOnCommandInit();
+    WeaponIndexOnCommandInit();
 }
 
 /**
@@ -324,6 +329,7 @@ void WeaponsOnClientInit(int client)
 {
     // Forward event to sub-modules
     WeaponMODOnClientInit(client);
+    WeaponIndexOnClientInit(client);
 }
 
 /**
@@ -1833,21 +1839,66 @@ int WeaponsGetLimit(int iD)
 }
 
 /**
- * @brief Remove the buy limit of the all client weapons.
+ * @brief Creates the buy limit table of the all client weapons.
  *
- * @param client            The client index.
+ * @note The existing counters are kept when the table is rebuilt.
+ *
+ * @param iSize             The amount of weapons.
  **/
-void WeaponsRemoveLimits(int client)
+void WeaponsCreateLimits(int iSize)
 {
-    // If array hasn't been created, then create
-    if (gClientData[client].WeaponLimit == null)
+    // Gets the size of the current table
+    int iOldSize = (gServerData.WeaponLimits != null) ? gServerData.WeaponLimits.Length / (MAXPLAYERS + 1) : -1;
+    
+    // Validate size, the counters are kept on reload
+    if (iOldSize == iSize)
     {
-        // Initialize a buy limit array
-        gClientData[client].WeaponLimit = new StringMap();
+        return;
     }
+    
+    // Initialize a buy limit table with one counter per client and weapon
+    ArrayList hLimits = new ArrayList(2, iSize * (MAXPLAYERS + 1));
+    
+    // i = client index
+    for (int i = 0; i <= MAXPLAYERS; i++)
+    {
+        // x = weapon index
+        for (int x = 0; x < iSize; x++)
+        {
+            // Gets counter index
+            int iIndex = i * iSize + x;
+            
+            // Copy the existing counter
+            if (x < iOldSize)
+            {
+                int iOldIndex = i * iOldSize + x;
+                hLimits.Set(iIndex, gServerData.WeaponLimits.Get(iOldIndex, LIMITS_DATA_COUNT), LIMITS_DATA_COUNT);
+                hLimits.Set(iIndex, gServerData.WeaponLimits.Get(iOldIndex, LIMITS_DATA_EPOCH), LIMITS_DATA_EPOCH);
+            }
+            else
+            {
+                hLimits.Set(iIndex, 0, LIMITS_DATA_COUNT);
+                hLimits.Set(iIndex, 0, LIMITS_DATA_EPOCH);
+            }
+        }
+    }
+    
+    // Replace the table
+    delete gServerData.WeaponLimits;
+    gServerData.WeaponLimits = hLimits;
+}
 
-    // Clear out the array of all data
-    gClientData[client].WeaponLimit.Clear();
+/**
+ * @brief Remove the buy limit of the all client weapons.
+ *
+ * @note Counters of the previous epoch are treated as zero.
+ *
+ * @param client            The client index.
+ **/
+void WeaponsRemoveLimits(int client)
+{
+    // Sets the new epoch
+    gClientData[client].WeaponEpoch = ++gServerData.LimitEpoch;
 }
 
 /**
@@ -1859,19 +1910,18 @@ void WeaponsRemoveLimits(int client)
  **/
 void WeaponsSetLimits(int client, int iD, int iLimit)
 {
-    // If array hasn't been created, then create
-    if (gClientData[client].WeaponLimit == null)
+    // If epoch hasn't been started, then start
+    if (!gClientData[client].WeaponEpoch)
     {
-        // Initialize a buy limit array
-        gClientData[client].WeaponLimit = new StringMap();
+        WeaponsRemoveLimits(client);
     }
 
-    // Initialize key char
-    static char sKey[SMALL_LINE_LENGTH];
-    IntToString(iD, sKey, sizeof(sKey));
+    // Gets counter index
+    int iIndex = client * gServerData.Weapons.Length + iD;
     
     // Sets buy limit for the client
-    gClientData[client].WeaponLimit.SetValue(sKey, iLimit);
+    gServerData.WeaponLimits.Set(iIndex, iLimit, LIMITS_DATA_COUNT);
+    gServerData.WeaponLimits.Set(iIndex, gClientData[client].WeaponEpoch, LIMITS_DATA_EPOCH);
 }
 
 /**
@@ -1882,20 +1932,17 @@ void WeaponsSetLimits(int client, int iD, int iLimit)
  **/
 int WeaponsGetLimits(int client, int iD)
 {
-    // If array hasn't been created, then create
-    if (gClientData[client].WeaponLimit == null)
+    // Gets counter index
+    int iIndex = client * gServerData.Weapons.Length + iD;
+    
+    // Validate epoch
+    if (gServerData.WeaponLimits.Get(iIndex, LIMITS_DATA_EPOCH) != gClientData[client].WeaponEpoch)
     {
-        // Initialize a buy limit array
-        gClientData[client].WeaponLimit = new StringMap();
+        return 0;
     }
     
-    // Initialize key char
-    static char sKey[SMALL_LINE_LENGTH];
-    IntToString(iD, sKey, sizeof(sKey));
-    
     // Gets buy limit for the client
-    int iLimit; gClientData[client].WeaponLimit.GetValue(sKey, iLimit);
-    return iLimit;
+    return gServerData.WeaponLimits.Get(iIndex, LIMITS_DATA_COUNT);
 }
 
 /**
@@ -2248,88 +2295,6 @@ float WeaponsGetModelHeat(int iD)
     return arrayWeapon.Get(WEAPONS_DATA_MODEL_HEAT);
 }
 
-/**
- * @brief Sets the amount of the weapon sequences.
- *
- * @param iD                The weapon id.
- * @param iSequence         The sequences amount.
- **/
-void WeaponsSetSequenceCount(int iD, int iSequence)
-{
-    // Gets array handle of weapon at given index
-    ArrayList arrayWeapon = gServerData.Weapons.Get(iD);
-    
-    // Sets weapon sequences amount
-    arrayWeapon.Set(WEAPONS_DATA_SEQUENCE_COUNT, iSequence);
-}
-
-/**
- * @brief Gets the amount of the weapon sequences.
- *
- * @param iD                The weapon id.
- * @return                  The sequences amount.
- **/
-int WeaponsGetSequenceCount(int iD)
-{
-    // Gets array handle of weapon at given index
-    ArrayList arrayWeapon = gServerData.Weapons.Get(iD);
-    
-    // Gets weapon sequences amount
-    return arrayWeapon.Get(WEAPONS_DATA_SEQUENCE_COUNT);
-}
-
-/**
- * @brief Sets the swap of the weapon sequences.
- *
- * @param iD                The weapon id.
- * @param iSeq              The array to return sequences in.
- * @param iMaxLen           The max length of the array.
- **/
-void WeaponsSetSequenceSwap(int iD, int[] iSeq, int iMaxLen)
-{
-    // Gets array handle of weapon at given index
-    ArrayList arrayWeapon = gServerData.Weapons.Get(iD);
-    
-    // Sets weapon sequences swap
-    arrayWeapon.SetArray(WEAPONS_DATA_SEQUENCE_SWAP, iSeq, iMaxLen);
-}
-
-/**
- * @brief Gets the swap of the weapon sequences. (at index)
- *
- * @param iD                The weapon id.
- * @param iSequence         The position index.
- * @return                  The sequences index.
- **/
-int WeaponsGetSequenceSwap(int iD, int iSequence)
-{
-    // Create a array
-    static int iSeq[WEAPONS_SEQUENCE_MAX];
-
-    // Gets array handle of weapon at given index
-    ArrayList arrayWeapon = gServerData.Weapons.Get(iD);
-
-    // Gets weapon sequences swap at index
-    arrayWeapon.GetArray(WEAPONS_DATA_SEQUENCE_SWAP, iSeq, sizeof(iSeq));
-
-    // Gets weapon sequence
-    return iSeq[iSequence];
-}
-
-/**
- * @brief Clears the swap of the weapon sequences.
- *
- * @param iD                The weapon id.
- **/
-void WeaponsClearSequenceSwap(int iD)
-{
-    // Gets array handle of weapon at given index
-    ArrayList arrayWeapon = gServerData.Weapons.Get(iD);
-    
-    // Clear weapon sequences swap
-    arrayWeapon.Erase(WEAPONS_DATA_SEQUENCE_SWAP);
-}
-
 /*
  * Generic weapons API.
  */
@@ -2483,6 +2448,7 @@ bool WeaponsRemove(int client)
                 {
                     // Forces a player to remove weapon
                     RemovePlayerItem(client, weapon);
+                    WeaponIndexRemove(client, weapon);
                     AcceptEntityInput(weapon, "Kill"); /// Destroy
                     
                     // Sets for return
@@ -2814,32 +2780,19 @@ int WeaponsSpawn(int iItem, float vPosition[3] = {0.0, 0.0, 0.0}, float vAngle[3
  **/
 int WeaponsFindByName(int client, char[] sType)
 {
-    // Initialize classname char
-    static char sClassname[SMALL_LINE_LENGTH];
-
-    // i = weapon number
-    int iSize = ToolsGetMyWeapons(client);
-    for (int i = 0; i < iSize; i++)
-    {
-        // Gets weapon index
-        int weapon = ToolsGetWeapon(client, i);
-
-        // Validate weapon
-        if (weapon != -1)
-        {
-            // Gets weapon classname
-            GetEdictClassname(weapon, sClassname, sizeof(sClassname));
-
-            // If weapon find, then return
-            if (!strcmp(sClassname[7], sType[7], false))
-            {
-                return weapon;
-            }
-        }
-    }
+    return WeaponIndexFindByName(client, sType);
+}
 
-    // Weapon doesn't exist
-    return -1;
+/**
+ * @brief Returns index if the player has a weapon.
+ *
+ * @param client            The client index.
+ * @param iItem             The def index.
+ * @return                  The weapon index.
+ **/
+int WeaponsFindByDef(int client, ItemDef iItem)
+{
+    return WeaponIndexFindByDef(client, iItem);
 }
 
 /**
@@ -2862,26 +2815,7 @@ SlotType WeaponsGetSlotType(int weapon)
  **/
 bool WeaponsValidateByID(int client, int iD)
 {
-    // i = weapon number
-    int iSize = ToolsGetMyWeapons(client);
-    for (int i = 0; i < iSize; i++)
-    {
-        // Gets weapon index
-        int weapon = ToolsGetWeapon(client, i);
-        
-        // Validate weapon
-        if (weapon != -1)
-        {
-            // If weapon find, then return
-            if (WeaponsGetCustomID(weapon) == iD)
-            {
-                return true;
-            }
-        }
-    }
-
-    // Index doesn't exist
-    return false;
+    return (WeaponIndexFindByID(client, iD) != -1);
 }
 
 /**
@@ -557,27 +557,19 @@ void WeaponAttachCreateAddons(int client, int iD, BitType mBits, char[] sAttach)
             static char sModel[PLATFORM_LINE_LENGTH];
             WeaponsGetModelDrop(iD, sModel, sizeof(sModel)); 
     
-            // Create an attach addon entity 
-            int entity = UTIL_CreateDynamic("backpack", NULL_VECTOR, NULL_VECTOR, sModel);
+            // Gets an attach addon entity from the pool
+            int entity = AttachPoolAcquire(client, view_as<int>(mBits), "backpack", sModel, true);
             
             // If entity isn't valid, then skip
             if (entity != -1)
             {
                 // Sets bodygroup/skin for the entity
                 ToolsSetTextures(entity, WeaponsGetModelBody(iD, ModelType_Drop), WeaponsGetModelSkin(iD, ModelType_Drop)); 
-
-                // Sets parent to the entity
-                SetVariantString("!activator");
-                AcceptEntityInput(entity, "SetParent", client, entity);
-                ToolsSetOwner(entity, client);
                 
                 // Sets attachment to the entity
                 SetVariantString(sAttach);
                 AcceptEntityInput(entity, "SetParentAttachment", client, entity);
                 
-                // Hook entity callbacks
-                SDKHook(entity, SDKHook_SetTransmit, ToolsOnEntityTransmit);
-                
                 // Store the client cache
                 gClientData[client].AttachmentAddons[mBits] = EntIndexToEntRef(entity);
             }
@@ -599,14 +591,8 @@ void WeaponAttachRemoveAddons(int client, BitType mBits = BitType_Invalid)
         // i = slot index
         for (BitType i = BitType_PrimaryWeapon; i <= BitType_Shield; i++)
         {
-            // Gets current addon from the client reference
-            int entity = EntRefToEntIndex(gClientData[client].AttachmentAddons[i]);
-    
-            // Validate addon
-            if (entity != -1) 
-            {
-                AcceptEntityInput(entity, "Kill");
-            }
+            // Hide current addon for the next reuse
+            AttachPoolRelease(client, view_as<int>(i));
 
             // Clear the client cache
             gClientData[client].AttachmentBits = CSAddon_NONE;
@@ -615,14 +601,8 @@ void WeaponAttachRemoveAddons(int client, BitType mBits = BitType_Invalid)
     }
     else
     {
-        // Gets current addon from the client reference
-        int entity = EntRefToEntIndex(gClientData[client].AttachmentAddons[mBits]);
-
-        // Validate addon
-        if (entity != -1) 
-        {
-            AcceptEntityInput(entity, "Kill");
-        }
+        // Hide current addon for the next reuse
+        AttachPoolRelease(client, view_as<int>(mBits));
 
         // Clear the client cache
         gClientData[client].AttachmentBits = CSAddon_NONE;
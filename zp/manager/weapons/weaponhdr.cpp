@@ -25,6 +25,61 @@
  * ============================================================================
  **/
 
+/**
+ * @section Sequence table blocks.
+ **/
+enum
+{
+    WEAPONHDR_SEQUENCE_COUNT,
+    WEAPONHDR_SEQUENCE_IDLE,
+    WEAPONHDR_SEQUENCE_ACTIVITY,
+    WEAPONHDR_SEQUENCE_SWAP = WEAPONHDR_SEQUENCE_ACTIVITY + WEAPONS_SEQUENCE_MAX,
+    WEAPONHDR_SEQUENCE_BLOCK = WEAPONHDR_SEQUENCE_SWAP + WEAPONS_SEQUENCE_MAX
+};
+/**
+ * @endsection
+ **/
+ 
+/**
+ * Max size of the model precache table.
+ **/
+#define WEAPONHDR_MODEL_MAX 8192
+
+/**
+ * Activity of the idle sequences.
+ **/
+#define ACT_VM_IDLE 185
+
+/**
+ * Arrays to store the sequence table per model index.
+ **/
+int gWeaponHDRSlot[WEAPONHDR_MODEL_MAX]; ArrayList gWeaponHDRTable;
+
+/**
+ * @brief Resets the sequence table during the loading.
+ **/
+void WeaponHDROnLoad(/*void*/)
+{
+    // If array hasn't been created, then create
+    if (gWeaponHDRTable == null)
+    {
+        // Initialize a sequence table
+        gWeaponHDRTable = new ArrayList(WEAPONHDR_SEQUENCE_BLOCK);
+    }
+    else
+    {
+        // Clear out the array of all data
+        gWeaponHDRTable.Clear();
+    }
+    
+    // i = model index
+    for (int i = 0; i < WEAPONHDR_MODEL_MAX; i++)
+    {
+        // Model indexes are changed on the map change
+        gWeaponHDRSlot[i] = -1;
+    }
+}
+
 /**
  * @brief Creates the swapped (custom) weapon for the client.
  *
@@ -290,11 +345,11 @@ void WeaponHDRSetWeaponVisibility(int weapon, bool bInvisible)
  *
  * @param iSequences        The sequence array.
  * @param iSequenceCount    The sequence count.
- * @param weapon            The weapon index.
+ * @param iActivity         The activity array.
  * @param iIndex            The sequence cell.
  * @return                  The sequence index.
  **/
-int WeaponHDRBuildSwapSequenceArray(int iSequences[WEAPONS_SEQUENCE_MAX], int iSequenceCount, int weapon, int iIndex = 0)
+int WeaponHDRBuildSwapSequenceArray(int iSequences[WEAPONS_SEQUENCE_MAX], int iSequenceCount, int iActivity[WEAPONS_SEQUENCE_MAX], int iIndex = 0)
 {
     #define SWAP_SEQ_PAIRED (1<<31)
     
@@ -305,12 +360,12 @@ int WeaponHDRBuildSwapSequenceArray(int iSequences[WEAPONS_SEQUENCE_MAX], int iS
     if (!iValue)
     {
         // Continue to next if sequence wasn't an activity
-        if ((iValue = iSequences[iIndex] = ToolsGetSequenceActivity(weapon, iIndex)) == -1)
+        if ((iValue = iSequences[iIndex] = iActivity[iIndex]) == -1)
         {
             // Validate not a filled sequence
             if (++iIndex < iSequenceCount)
             {
-                WeaponHDRBuildSwapSequenceArray(iSequences, iSequenceCount, weapon, iIndex);
+                WeaponHDRBuildSwapSequenceArray(iSequences, iSequenceCount, iActivity, iIndex);
                 return -1;
             }
             
@@ -324,7 +379,7 @@ int WeaponHDRBuildSwapSequenceArray(int iSequences[WEAPONS_SEQUENCE_MAX], int iS
         // Validate not a filled sequence
         if (++iIndex < iSequenceCount)
         {
-            WeaponHDRBuildSwapSequenceArray(iSequences, iSequenceCount, weapon, iIndex);
+            WeaponHDRBuildSwapSequenceArray(iSequences, iSequenceCount, iActivity, iIndex);
             return -1;
         }
         // Return on success
@@ -349,7 +404,7 @@ int WeaponHDRBuildSwapSequenceArray(int iSequences[WEAPONS_SEQUENCE_MAX], int iS
     for (int i = iIndex + 1; i < iSequenceCount; i++)
     {
         // Find next sequence
-        int iNext = WeaponHDRBuildSwapSequenceArray(iSequences, iSequenceCount, weapon, i);
+        int iNext = WeaponHDRBuildSwapSequenceArray(iSequences, iSequenceCount, iActivity, i);
 
         // Validate cell
         if (iValue == iNext)
@@ -368,4 +423,131 @@ int WeaponHDRBuildSwapSequenceArray(int iSequences[WEAPONS_SEQUENCE_MAX], int iS
     
     // Return the sequence cell
     return iValue;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Gets the sequence table of the entity model.
+ *
+ * @note The table is built only once per model index, 
+ *       so the studio header is read only on the first use of the model.
+ *
+ * @param entity            The entity index.
+ * @return                  The table index, or -1 on failure.
+ **/
+int WeaponHDRGetSequenceTable(int entity)
+{
+    // Gets model index
+    int iModel = GetEntProp(entity, Prop_Send, "m_nModelIndex");
+    
+    // Validate index
+    if (iModel <= 0 || iModel >= WEAPONHDR_MODEL_MAX)
+    {
+        return -1;
+    }
+    
+    // Validate cache (-2 is a failed model)
+    int iTable = gWeaponHDRSlot[iModel];
+    if (iTable != -1)
+    {
+        return (iTable >= 0) ? iTable : -1;
+    }
+    
+    // Sets failed state for the errors below
+    gWeaponHDRSlot[iModel] = -2;
+
+    // Gets model path
+    static char sModel[PLATFORM_LINE_LENGTH];
+    GetEntPropString(entity, Prop_Data, "m_ModelName", sModel, sizeof(sModel));
+    
+    // Gets sequence amount from a entity
+    int iSequenceCount = ToolsGetSequenceCount(entity);
+    
+    // Validate count
+    if (iSequenceCount <= 0)
+    {
+        // Unexpected error, log it
+        LogEvent(false, LogType_Error, LOG_GAME_EVENTS, LogModule_Weapons, "Weapons HDR", "Failed to get sequence count for weapon using model \"%s\" - Animations may not work as expected", sModel);
+        return -1;
+    }
+    
+    // Validate amount
+    if (iSequenceCount >= WEAPONS_SEQUENCE_MAX)
+    {
+        // Unexpected error, log it
+        LogEvent(false, LogType_Error, LOG_GAME_EVENTS, LogModule_Weapons, "Weapons HDR", "View model \"%s\" is having too many sequences! (Max %d, is %d) - Increase value of WEAPONS_SEQUENCE_MAX in plugin", sModel, WEAPONS_SEQUENCE_MAX, iSequenceCount);
+        return -1;
+    }
+
+    // Initialize the table arrays
+    int iRow[WEAPONHDR_SEQUENCE_BLOCK]; int iActivity[WEAPONS_SEQUENCE_MAX]; int iSequences[WEAPONS_SEQUENCE_MAX]; int iIdle;
+    
+    // i = sequence index
+    for (int i = 0; i < iSequenceCount; i++)
+    {
+        // Gets sequence activity
+        iActivity[i] = iRow[WEAPONHDR_SEQUENCE_ACTIVITY + i] = ToolsGetSequenceActivity(entity, i);
+        
+        // Validate idle
+        if (iActivity[i] == ACT_VM_IDLE)
+        {
+            iIdle |= (1 << i);
+        }
+    }
+    
+    // Build the sequence array
+    WeaponHDRBuildSwapSequenceArray(iSequences, iSequenceCount, iActivity);
+
+    // i = sequence index
+    for (int i = 0; i < WEAPONS_SEQUENCE_MAX; i++)
+    {
+        // Unused sequences are not swapped
+        iRow[WEAPONHDR_SEQUENCE_SWAP + i] = (i < iSequenceCount) ? iSequences[i] : -1;
+    }
+    
+    // Push data into table
+    iRow[WEAPONHDR_SEQUENCE_COUNT] = iSequenceCount;
+    iRow[WEAPONHDR_SEQUENCE_IDLE] = iIdle;
+    iTable = gWeaponHDRTable.PushArray(iRow, sizeof(iRow));
+    
+    // Return on success
+    gWeaponHDRSlot[iModel] = iTable;
+    return iTable;
+}
+
+/**
+ * @brief Gets the swap of the sequence from the sequence table.
+ *
+ * @param iTable            The table index.
+ * @param iSequence         The sequence index.
+ * @return                  The sequence index, or -1 if sequence doesn't have a pair.
+ **/
+int WeaponHDRGetSequenceSwap(int iTable, int iSequence)
+{
+    // Validate sequence
+    if (iTable == -1 || iSequence < 0 || iSequence >= WEAPONS_SEQUENCE_MAX)
+    {
+        return -1;
+    }
+    
+    // Gets sequence swap
+    return gWeaponHDRTable.Get(iTable, WEAPONHDR_SEQUENCE_SWAP + iSequence);
+}
+
+/**
+ * @brief Validates the idle sequence from the sequence table.
+ *
+ * @param iTable            The table index.
+ * @param iSequence         The sequence index.
+ * @return                  True or false.
+ **/
+bool WeaponHDRIsIdleSequence(int iTable, int iSequence)
+{
+    // Validate sequence
+    if (iTable == -1 || iSequence < 0 || iSequence >= WEAPONS_SEQUENCE_MAX)
+    {
+        return false;
+    }
+    
+    // Gets idle state
+    return (gWeaponHDRTable.Get(iTable, WEAPONHDR_SEQUENCE_IDLE) & (1 << iSequence)) != 0;
+}
@@ -0,0 +1,481 @@
+/**
+ * ============================================================================
+ *
+ *  Zombie Plague
+ *
+ *  File:          weaponindex.cpp
+ *  Type:          Module
+ *  Description:   Index of the weapons which are owned by clients.
+ *
+ *  Copyright (C) 2015-2020 Nikita Ushakov (Ireland, Dublin)
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * ============================================================================
+ **/
+
+/**
+ * @section Index limits.
+ **/
+#define WEAPONS_INDEX_MAX   64  /** Size of m_hMyWeapons */
+#define WEAPONS_INDEX_CELLS 32  /** Bitset cells, 32 custom ids per cell */
+#define WEAPONS_INDEX_DEFS  1024 /** Size of the definition map, covers weapon and knife definitions */
+/**
+ * @endsection
+ **/
+
+/**
+ * Arrays to store the owned weapons.
+ **/
+int gWeaponIndexRef[MAXPLAYERS+1][WEAPONS_INDEX_MAX]; int gWeaponIndexID[MAXPLAYERS+1][WEAPONS_INDEX_MAX]; ItemDef gWeaponIndexItem[MAXPLAYERS+1][WEAPONS_INDEX_MAX];
+char gWeaponIndexName[MAXPLAYERS+1][WEAPONS_INDEX_MAX][SMALL_LINE_LENGTH]; int gWeaponIndexCount[MAXPLAYERS+1]; int gWeaponIndexBits[MAXPLAYERS+1][WEAPONS_INDEX_CELLS];
+int gWeaponIndexDef[MAXPLAYERS+1][WEAPONS_INDEX_DEFS];
+
+/**
+ * @brief Creates commands for index module.
+ **/
+void WeaponIndexOnCommandInit(/*void*/)
+{
+    // Hook commands
+    RegAdminCmd("zp_weapon_index_check", WeaponIndexOnCommandCatched, ADMFLAG_CONFIG, "Validates the owned weapons index against the real inventory. Usage: zp_weapon_index_check");
+}
+
+/**
+ * @brief Client has been joined.
+ *
+ * @param client            The client index.
+ **/
+void WeaponIndexOnClientInit(int client)
+{
+    // Hook entity callbacks
+    SDKHook(client, SDKHook_WeaponDropPost, WeaponIndexOnDropPost);
+
+    // Build the index from the inventory
+    WeaponIndexRebuild(client);
+}
+
+/**
+ * Console command callback (zp_weapon_index_check)
+ * @brief Validates the owned weapons index against the real inventory.
+ *
+ * @param client            The client index.
+ * @param iArguments        The number of arguments that were in the argument string.
+ **/
+public Action WeaponIndexOnCommandCatched(int client, int iArguments)
+{
+    // Initialize variables
+    int iChecked; int iMissing; int iStale;
+
+    // i = client index
+    for (int i = 1; i <= MaxClients; i++)
+    {
+        // Validate client
+        if (!IsPlayerExist(i, false))
+        {
+            continue;
+        }
+
+        // x = weapon number
+        int iSize = ToolsGetMyWeapons(i);
+        for (int x = 0; x < iSize; x++)
+        {
+            // Gets weapon index
+            int weapon = ToolsGetWeapon(i, x);
+
+            // Validate weapon
+            if (weapon != -1)
+            {
+                // Validate entry
+                iChecked++;
+                if (WeaponIndexFind(i, weapon) == -1)
+                {
+                    iMissing++;
+                    ReplyToCommand(client, "[ZP] Missing: client %N, weapon %d", i, weapon);
+                }
+            }
+        }
+
+        // x = entry index
+        for (int x = 0; x < gWeaponIndexCount[i]; x++)
+        {
+            // Validate entry
+            int weapon = EntRefToEntIndex(gWeaponIndexRef[i][x]);
+            if (weapon == -1 || ToolsGetOwner(weapon) != i)
+            {
+                iStale++;
+                ReplyToCommand(client, "[ZP] Stale: client %N, weapon %d (%s)", i, weapon, gWeaponIndexName[i][x]);
+            }
+        }
+    }
+
+    // Send information into the console
+    ReplyToCommand(client, "[ZP] Checked: %d | Missing: %d | Stale: %d", iChecked, iMissing, iStale);
+    return Plugin_Handled;
+}
+
+/**
+ * Hook: WeaponDropPost
+ * @brief Player dropped any weapon.
+ *
+ * @param client            The client index.
+ * @param weapon            The weapon index.
+ **/
+public void WeaponIndexOnDropPost(int client, int weapon)
+{
+    // Remove weapon from the index
+    WeaponIndexRemove(client, weapon);
+}
+
+/*
+ * Stocks index API.
+ */
+
+/**
+ * @brief Rebuilds the index from the client inventory.
+ *
+ * @param client            The client index.
+ **/
+void WeaponIndexRebuild(int client)
+{
+    // Clear out the index
+    gWeaponIndexCount[client] = 0;
+    for (int i = 0; i < WEAPONS_INDEX_CELLS; i++)
+    {
+        gWeaponIndexBits[client][i] = 0;
+    }
+    for (int i = 0; i < WEAPONS_INDEX_DEFS; i++)
+    {
+        gWeaponIndexDef[client][i] = INVALID_ENT_REFERENCE;
+    }
+
+    // Validate client
+    if (!IsPlayerExist(client, false))
+    {
+        return;
+    }
+
+    // i = weapon number
+    int iSize = ToolsGetMyWeapons(client);
+    for (int i = 0; i < iSize; i++)
+    {
+        // Gets weapon index
+        int weapon = ToolsGetWeapon(client, i);
+
+        // Validate weapon
+        if (weapon != -1)
+        {
+            // Add weapon to the index
+            WeaponIndexAdd(client, weapon);
+        }
+    }
+}
+
+/**
+ * @brief Adds the weapon to the client index.
+ *
+ * @param client            The client index.
+ * @param weapon            The weapon index.
+ **/
+void WeaponIndexAdd(int client, int weapon)
+{
+    // Validate entry
+    if (WeaponIndexFind(client, weapon) != -1 || gWeaponIndexCount[client] >= WEAPONS_INDEX_MAX)
+    {
+        return;
+    }
+
+    // Push data into array
+    int iIndex = gWeaponIndexCount[client]++;
+    gWeaponIndexRef[client][iIndex] = EntIndexToEntRef(weapon);
+    gWeaponIndexID[client][iIndex] = WeaponsGetCustomID(weapon);
+    gWeaponIndexItem[client][iIndex] = view_as<ItemDef>(GetEntProp(weapon, Prop_Send, "m_iItemDefinitionIndex"));
+    GetEdictClassname(weapon, gWeaponIndexName[client][iIndex], sizeof(gWeaponIndexName[][]));
+
+    // Sets the id bit
+    WeaponIndexSetBit(client, gWeaponIndexID[client][iIndex], true);
+    
+    // Sets the definition entry
+    int iDef = view_as<int>(gWeaponIndexItem[client][iIndex]);
+    if (0 <= iDef < WEAPONS_INDEX_DEFS) gWeaponIndexDef[client][iDef] = gWeaponIndexRef[client][iIndex];
+}
+
+/**
+ * @brief Removes the weapon from the client index.
+ *
+ * @param client            The client index.
+ * @param weapon            The weapon index.
+ **/
+void WeaponIndexRemove(int client, int weapon)
+{
+    // Validate entry
+    int iIndex = WeaponIndexFind(client, weapon);
+    if (iIndex != -1)
+    {
+        // Remove entry
+        WeaponIndexErase(client, iIndex);
+    }
+}
+
+/**
+ * @brief Erases the entry by swapping it with the last one.
+ *
+ * @param client            The client index.
+ * @param iIndex            The entry index.
+ **/
+void WeaponIndexErase(int client, int iIndex)
+{
+    // Gets id/definition/reference of the entry
+    int iD = gWeaponIndexID[client][iIndex]; int iDef = view_as<int>(gWeaponIndexItem[client][iIndex]); int iRef = gWeaponIndexRef[client][iIndex];
+
+    // Move the last entry
+    int iLast = --gWeaponIndexCount[client];
+    if (iIndex != iLast)
+    {
+        gWeaponIndexRef[client][iIndex] = gWeaponIndexRef[client][iLast];
+        gWeaponIndexID[client][iIndex] = gWeaponIndexID[client][iLast];
+        gWeaponIndexItem[client][iIndex] = gWeaponIndexItem[client][iLast];
+        strcopy(gWeaponIndexName[client][iIndex], sizeof(gWeaponIndexName[][]), gWeaponIndexName[client][iLast]);
+    }
+
+    // Validate definition entry
+    if (0 <= iDef < WEAPONS_INDEX_DEFS && gWeaponIndexDef[client][iDef] == iRef)
+    {
+        // Point it to any other entry with the same definition
+        gWeaponIndexDef[client][iDef] = INVALID_ENT_REFERENCE;
+        for (int i = 0; i < iLast; i++)
+        {
+            if (view_as<int>(gWeaponIndexItem[client][i]) == iDef)
+            {
+                gWeaponIndexDef[client][iDef] = gWeaponIndexRef[client][i];
+                break;
+            }
+        }
+    }
+
+    // i = entry index
+    for (int i = 0; i < iLast; i++)
+    {
+        // Validate same id
+        if (gWeaponIndexID[client][i] == iD)
+        {
+            return;
+        }
+    }
+
+    // Clear the id bit
+    WeaponIndexSetBit(client, iD, false);
+}
+
+/**
+ * @brief Validates the entry and erases it if weapon isn't owned anymore.
+ *
+ * @param client            The client index.
+ * @param iIndex            The entry index.
+ * @return                  The weapon index or -1 if the entry was erased.
+ **/
+int WeaponIndexValidate(int client, int iIndex)
+{
+    // Validate weapon
+    int weapon = EntRefToEntIndex(gWeaponIndexRef[client][iIndex]);
+    if (weapon != -1 && ToolsGetOwner(weapon) == client)
+    {
+        return weapon;
+    }
+
+    // Remove entry
+    WeaponIndexErase(client, iIndex);
+    return -1;
+}
+
+/**
+ * @brief Finds the entry of the weapon.
+ *
+ * @param client            The client index.
+ * @param weapon            The weapon index.
+ * @return                  The entry index or -1 if not found.
+ **/
+int WeaponIndexFind(int client, int weapon)
+{
+    // Gets weapon reference
+    int iRef = EntIndexToEntRef(weapon);
+
+    // i = entry index
+    for (int i = 0; i < gWeaponIndexCount[client]; i++)
+    {
+        // Validate reference
+        if (gWeaponIndexRef[client][i] == iRef)
+        {
+            return i;
+        }
+    }
+
+    // Entry doesn't exist
+    return -1;
+}
+
+/**
+ * @brief Finds the owned weapon by the custom id.
+ *
+ * @param client            The client index.
+ * @param iD                The weapon id.
+ * @return                  The weapon index or -1 if not found.
+ **/
+int WeaponIndexFindByID(int client, int iD)
+{
+    // Validate the id bit
+    if (!WeaponIndexGetBit(client, iD))
+    {
+        return -1;
+    }
+
+    // i = entry index
+    for (int i = gWeaponIndexCount[client] - 1; i >= 0; i--)
+    {
+        // Validate id
+        if (gWeaponIndexID[client][i] == iD)
+        {
+            // Validate entry
+            int weapon = WeaponIndexValidate(client, i);
+            if (weapon != -1)
+            {
+                return weapon;
+            }
+        }
+    }
+
+    // Weapon doesn't exist
+    return -1;
+}
+
+/**
+ * @brief Finds the owned weapon by the definition index.
+ *
+ * @param client            The client index.
+ * @param iItem             The definition index.
+ * @return                  The weapon index or -1 if not found.
+ **/
+int WeaponIndexFindByDef(int client, ItemDef iItem)
+{
+    // Validate definition map
+    int iDef = view_as<int>(iItem);
+    if (0 <= iDef < WEAPONS_INDEX_DEFS)
+    {
+        // Validate entry
+        int iRef = gWeaponIndexDef[client][iDef];
+        if (iRef == INVALID_ENT_REFERENCE)
+        {
+            return -1;
+        }
+        
+        // Validate weapon
+        int weapon = EntRefToEntIndex(iRef);
+        if (weapon != -1 && ToolsGetOwner(weapon) == client)
+        {
+            return weapon;
+        }
+        
+        /// Stale entry is evicted by the scan below
+    }
+
+    // i = entry index
+    for (int i = gWeaponIndexCount[client] - 1; i >= 0; i--)
+    {
+        // Validate definition
+        if (gWeaponIndexItem[client][i] == iItem)
+        {
+            // Validate entry
+            int weapon = WeaponIndexValidate(client, i);
+            if (weapon != -1)
+            {
+                return weapon;
+            }
+        }
+    }
+
+    // Weapon doesn't exist
+    return -1;
+}
+
+/**
+ * @brief Finds the owned weapon by the classname.
+ *
+ * @param client            The client index.
+ * @param sType             The weapon classname.
+ * @return                  The weapon index or -1 if not found.
+ **/
+int WeaponIndexFindByName(int client, char[] sType)
+{
+    // i = entry index
+    for (int i = gWeaponIndexCount[client] - 1; i >= 0; i--)
+    {
+        // Validate classname
+        if (!strcmp(gWeaponIndexName[client][i][7], sType[7], false))
+        {
+            // Validate entry
+            int weapon = WeaponIndexValidate(client, i);
+            if (weapon != -1)
+            {
+                return weapon;
+            }
+        }
+    }
+
+    // Weapon doesn't exist
+    return -1;
+}
+
+/**
+ * @brief Gets the custom id bit of the client.
+ *
+ * @param client            The client index.
+ * @param iD                The weapon id.
+ * @return                  True if the bit is set or the id is out of the bitset, false otherwise.
+ **/
+bool WeaponIndexGetBit(int client, int iD)
+{
+    // Validate id
+    if (iD < 0)
+    {
+        return false;
+    }
+
+    // Validate bitset size
+    if (iD >= WEAPONS_INDEX_CELLS * 32)
+    {
+        return true;
+    }
+
+    // Return the bit
+    return (gWeaponIndexBits[client][iD >> 5] & (1 << (iD & 31))) != 0;
+}
+
+/**
+ * @brief Sets the custom id bit of the client.
+ *
+ * @param client            The client index.
+ * @param iD                The weapon id.
+ * @param bSet              True to set the bit, false to clear it.
+ **/
+void WeaponIndexSetBit(int client, int iD, bool bSet)
+{
+    // Validate id
+    if (iD < 0 || iD >= WEAPONS_INDEX_CELLS * 32)
+    {
+        return;
+    }
+
+    // Sets the bit
+    if (bSet) gWeaponIndexBits[client][iD >> 5] |= (1 << (iD & 31));
+    else gWeaponIndexBits[client][iD >> 5] &= ~(1 << (iD & 31));
+}
@@ -1012,43 +1012,8 @@ public void WeaponMODOnDeployPost(int client, int weapon)
             WeaponHDRSetWeaponVisibility(view2, true);
             ToolsUpdateTransmitState(view2);
 
-            // If the sequence for the weapon didn't build yet
-            if (WeaponsGetSequenceCount(iD) == -1)
-            {
-                // Gets sequence amount from a weapon entity
-                int iSequenceCount = ToolsGetSequenceCount(weapon);
-
-                // Validate count
-                if (iSequenceCount)
-                {
-                    // Initialize the sequence array
-                    int iSequences[WEAPONS_SEQUENCE_MAX];
-
-                    // Validate amount
-                    if (iSequenceCount < WEAPONS_SEQUENCE_MAX)
-                    {
-                        // Build the sequence array
-                        WeaponHDRBuildSwapSequenceArray(iSequences, iSequenceCount, weapon);
-                        
-                        // Update the sequence array
-                        WeaponsSetSequenceCount(iD, iSequenceCount);
-                        WeaponsSetSequenceSwap(iD, iSequences, sizeof(iSequences));
-                    }
-                    else
-                    {
-                        // Unexpected error, log it
-                        LogEvent(false, LogType_Error, LOG_GAME_EVENTS, LogModule_Weapons, "Weapons HDR", "View model \"%s\" is having too many sequences! (Max %d, is %d) - Increase value of WEAPONS_SEQUENCE_MAX in plugin", sModel, WEAPONS_SEQUENCE_MAX, iSequenceCount);
-                    }
-                }
-                else
-                {
-                    // Remove swapped weapon
-                    WeaponsClearSequenceSwap(iD);
-                    
-                    // Unexpected error, log it
-                    LogEvent(false, LogType_Error, LOG_GAME_EVENTS, LogModule_Weapons, "Weapons HDR", "Failed to get sequence count for weapon using model \"%s\" - Animations may not work as expected", sModel);
-                }
-            }
+            // Build the sequence table of the model, if it wasn't built yet
+            WeaponHDRGetSequenceTable(weapon);
             
             // Gets body/skin index of a class
             int iBody = ClassGetBody(gClientData[client].Class);
@@ -1115,6 +1080,9 @@ public void WeaponMODOnEquipPost(int client, int weapon)
     // Validate weapon
     if (IsValidEdict(weapon))
     {
+        // Add weapon to the index
+        WeaponIndexAdd(client, weapon);
+        
         // Validate custom index
         int iD = WeaponsGetCustomID(weapon);
         if (iD != -1)    
@@ -1177,7 +1145,7 @@ public void WeaponMODOnAnimationFix(int client)
 
             // Gets weapon id from the reference
             int iD = gClientData[client].IndexWeapon; /// Only viewmodel identification
-            int swapSequence = WeaponsGetSequenceSwap(iD, iSequence);
+            int swapSequence = WeaponHDRGetSequenceSwap(WeaponHDRGetSequenceTable(gClientData[client].CustomWeapon), iSequence);
             
             // Validate swap sequence
             if (swapSequence != -1)
@@ -1191,10 +1159,8 @@ public void WeaponMODOnAnimationFix(int client)
             }
             else
             {
-                #define ACT_VM_IDLE 185
-        
                 // Stop toggling during the idle animation
-                if (ToolsGetSequenceActivity(view1, iSequence) != ACT_VM_IDLE)
+                if (!WeaponHDRIsIdleSequence(WeaponHDRGetSequenceTable(view1), iSequence))
                 {
                     // Creates a toggle model
                     WeaponHDRToggleViewModel(client, view2, iD);
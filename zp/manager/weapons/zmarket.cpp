@@ -334,12 +334,7 @@ void ZMarketMenu(int client, char[] sTitle, MenuType mSlot = MenuType_Equipments
 
     // Initialize variables
     static char sBuffer[NORMAL_LINE_LENGTH];
-    static char sName[SMALL_LINE_LENGTH];
     static char sInfo[SMALL_LINE_LENGTH];
-    static char sLevel[SMALL_LINE_LENGTH];
-    static char sLimit[SMALL_LINE_LENGTH];
-    static char sOnline[SMALL_LINE_LENGTH];
-    static char sGroup[SMALL_LINE_LENGTH];
     static char sClass[MAXPLAYERS+1][SMALL_LINE_LENGTH];
     
     // Update class type mode
@@ -347,6 +342,10 @@ void ZMarketMenu(int client, char[] sTitle, MenuType mSlot = MenuType_Equipments
     
     // Initialize variables
     Action hResult; Menu hMenu = ZMarketSlotToHandle(client, mSlot); bool bMenu = (mSlot != MenuType_Rebuy); bool bRebuy = (mSlot == MenuType_Add || mSlot == MenuType_Option);
+    
+    // Gets menu template (slot menus are filtered, others are indexed by id)
+    bool bSlot = (bMenu && !bRebuy); IntToString(bSlot ? view_as<int>(mSlot) : -1, sInfo, sizeof(sInfo));
+    ArrayList hTemplate = MenusGetTemplate(client, MenuTemplate_Weapons, sInfo); MenuRow hRow; int iPlaying = fnGetPlaying();
 
     // Sets language to target
     SetGlobalTransTarget(client);
@@ -380,11 +379,12 @@ void ZMarketMenu(int client, char[] sTitle, MenuType mSlot = MenuType_Equipments
     hMenu.SetTitle(sBuffer);
 
     // i = array number
-    int iSize = ZMarketSlotToCount(client, mSlot); int iAmount;
+    int iSize = bSlot ? hTemplate.Length : ZMarketSlotToCount(client, mSlot); int iAmount;
     for (int i = 0; i < iSize; i++)
     {
-        // Gets weapon id from the list
-        int iD = ZMarketSlotToIndex(client, mSlot, i);
+        // Gets weapon row from the list
+        hTemplate.GetArray(bSlot ? i : ZMarketSlotToIndex(client, mSlot, i), hRow, sizeof(hRow));
+        int iD = hRow.ID;
 
         // Validate add/option menu
         if (bRebuy)
@@ -400,16 +400,10 @@ void ZMarketMenu(int client, char[] sTitle, MenuType mSlot = MenuType_Equipments
             {
                 continue;
             }
-            
-            // Gets weapon data
-            WeaponsGetName(iD, sName, sizeof(sName));
-
-            // Format some chars for showing in menu    
-            FormatEx(sBuffer, sizeof(sBuffer), "%t", sName);
 
             // Show option
             IntToString(iD, sInfo, sizeof(sInfo));
-            hMenu.AddItem(sInfo, sBuffer);
+            hMenu.AddItem(sInfo, hRow.Name);
         }
         // Default menu
         else
@@ -423,31 +417,21 @@ void ZMarketMenu(int client, char[] sTitle, MenuType mSlot = MenuType_Equipments
                 continue;
             }
             
-            // Skip some weapons, if slot isn't equal
-            if (bMenu && WeaponsGetSlot(iD) != mSlot) 
-            {
-                continue;
-            }
-            
             // Skip some weapons, if class isn't equal
             if (!WeaponsValidateClass(client, iD))
             {
                 continue;
             }    
 
-            // Gets weapon data
-            WeaponsGetName(iD, sName, sizeof(sName));
-            WeaponsGetGroup(iD, sGroup, sizeof(sGroup));
+            // Gets client conditions
+            bool bLimit = (hRow.Limit && hRow.Limit <= WeaponsGetLimits(client, iD));
             
             // Format some chars for showing in menu
-            FormatEx(sLevel, sizeof(sLevel), "%t", "level", WeaponsGetLevel(iD));
-            FormatEx(sLimit, sizeof(sLimit), "%t", "limit", WeaponsGetLimit(iD));
-            FormatEx(sOnline, sizeof(sOnline), "%t", "online", WeaponsGetOnline(iD));      
-            FormatEx(sBuffer, sizeof(sBuffer), (WeaponsGetCost(iD)) ? "%t  %s  %t" : "%t  %s", sName, hasLength(sGroup) ? sGroup : (gClientData[client].Level < WeaponsGetLevel(iD)) ? sLevel : (WeaponsGetLimit(iD) && WeaponsGetLimit(iD) <= WeaponsGetLimits(client, iD)) ? sLimit : (fnGetPlaying() < WeaponsGetOnline(iD)) ? sOnline : "", "price", WeaponsGetCost(iD), "money");
+            FormatEx(sBuffer, sizeof(sBuffer), (hRow.Cost) ? "%s  %s  %s" : "%s  %s", hRow.Name, hasLength(hRow.Group) ? hRow.Group : (gClientData[client].Level < hRow.Level) ? hRow.LevelInfo : bLimit ? hRow.LimitInfo : (iPlaying < hRow.Online) ? hRow.OnlineInfo : "", hRow.PriceInfo);
 
             // Show option
             IntToString(iD, sInfo, sizeof(sInfo));
-            hMenu.AddItem(sInfo, sBuffer, MenusGetItemDraw((hResult == Plugin_Handled || (hasLength(sGroup) && !IsPlayerInGroup(client, sGroup)) || WeaponsValidateByID(client, iD) || gClientData[client].Level < WeaponsGetLevel(iD) || fnGetPlaying() < WeaponsGetOnline(iD) || (WeaponsGetLimit(iD) && WeaponsGetLimit(iD) <= WeaponsGetLimits(client, iD)) || (WeaponsGetCost(iD) && gClientData[client].Money < WeaponsGetCost(iD))) ? false : true));
+            hMenu.AddItem(sInfo, sBuffer, MenusGetItemDraw((hResult == Plugin_Handled || (hasLength(hRow.Group) && !IsPlayerInGroup(client, hRow.Group)) || WeaponsValidateByID(client, iD) || gClientData[client].Level < hRow.Level || iPlaying < hRow.Online || bLimit || (hRow.Cost && gClientData[client].Money < hRow.Cost)) ? false : true));
         }
         
         // Increment amount
@@ -1079,6 +1063,41 @@ Menu ZMarketSlotToHandle(int client, MenuType mSlot)
     }
 }
 
+/**
+ * @brief Fills the weapons menu template.
+ *  
+ * @param hTemplate         The array of rows.
+ * @param sKey              The slot index, or -1 for all weapons.
+ **/ 
+void ZMarketMenuTemplate(ArrayList hTemplate, char[] sKey)
+{
+    // Initialize variables
+    static char sName[SMALL_LINE_LENGTH];
+    static char sGroup[SMALL_LINE_LENGTH]; MenuRow hRow;
+    
+    // Gets slot index
+    MenuType mSlot = view_as<MenuType>(StringToInt(sKey));
+    
+    // i = weapon id
+    int iSize = gServerData.Weapons.Length;
+    for (int i = 0; i < iSize; i++)
+    {
+        // Skip some weapons, if slot isn't equal
+        if (mSlot != MenuType_Invalid && WeaponsGetSlot(i) != mSlot) 
+        {
+            continue;
+        }
+        
+        // Gets weapon data
+        WeaponsGetName(i, sName, sizeof(sName));
+        WeaponsGetGroup(i, sGroup, sizeof(sGroup));
+        
+        // Push row into array
+        MenusSetTemplateRow(hRow, i, sName, sGroup, WeaponsGetCost(i), WeaponsGetLevel(i), WeaponsGetLimit(i), WeaponsGetOnline(i));
+        hTemplate.PushArray(hRow, sizeof(hRow));
+    }
+}
+
 /**
  * @brief Find the index at which the slot type is at.
  * 